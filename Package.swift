@@ -7,7 +7,10 @@ let package = Package(
     products: [
         .library(
             name: "SealdSdk",
-            targets: ["SealdSdk"])
+            targets: ["SealdSdk"]),
+        .library(
+            name: "SealdSdkBenchmarks",
+            targets: ["SealdSdkBenchmarks"])
     ],
     targets: [
         .target(
@@ -16,6 +19,17 @@ let package = Package(
             path: "SealdSdk/Classes",
             publicHeadersPath: "."
         ),
+        .target(
+            name: "SealdSdkBenchmarks",
+            dependencies: ["SealdSdk"],
+            path: "SealdSdk/Benchmarks",
+            publicHeadersPath: "."
+        ),
+        .testTarget(
+            name: "SealdSdkBenchmarksRunner",
+            dependencies: ["SealdSdkBenchmarks"],
+            path: "SealdSdk/BenchmarksRunner"
+        ),
         .binaryTarget(
             name: "SealdSdkInternals",
             path: "SealdSdk/Frameworks/SealdSdkInternals.xcframework"
@@ -0,0 +1,137 @@
+//
+//  SealdBenchmark.h
+//  SealdSdkBenchmarks
+//
+//  Created by Seald SAS on 18/10/2026.
+//  Copyright © 2026 Seald SAS. All rights reserved.
+//
+
+#ifndef SealdBenchmark_h
+#define SealdBenchmark_h
+
+#import <Foundation/Foundation.h>
+@import SealdSdk;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * SealdBenchmarkOptions represents options for SealdBenchmark.
+ */
+@interface SealdBenchmarkOptions : NSObject
+/** The Seald server for the benchmarked instance to use. Point it to a local mock server to get reproducible numbers. */
+@property (atomic, strong) NSString* apiUrl;
+/** The ID of the app on the Seald server. */
+@property (atomic, strong) NSString* appId;
+/** A signup JWT, used to create the account needed by the session and encryption benchmarks. If `nil`, only the benchmarks that do not need an account are run. */
+@property (atomic, strong, nullable) NSString* signupJwt;
+/** Sizes, in bytes, of the messages to encrypt / decrypt. Defaults to 64 B, 1 kB, 16 kB and 256 kB. */
+@property (atomic, strong) NSArray<NSNumber*>* messageSizes;
+/** Sizes, in bytes, of the files to encrypt / decrypt. Defaults to 64 kB, 1 MB and 8 MB. */
+@property (atomic, strong) NSArray<NSNumber*>* fileSizes;
+/** Sizes of the arrays to convert when measuring the bridge overhead. Defaults to 10, 100, 1000 and 10000. */
+@property (atomic, strong) NSArray<NSNumber*>* bridgeArraySizes;
+/** Number of iterations for each measurement. Defaults to 20. */
+@property (atomic, assign) NSInteger iterations;
+/** Number of key pairs to generate when measuring `generatePrivateKeys`. Defaults to 3. */
+@property (atomic, assign) NSInteger keyGenerationIterations;
+/** Number of sessions whose keys are re-encrypted when measuring `massReencrypt`. `0` to skip this benchmark. Defaults to 100. */
+@property (atomic, assign) NSInteger reencryptKeysCount;
+/** Values of SealdMassReencryptOptions.concurrency to measure `massReencrypt` with. Defaults to 1, 2, 4 and 8. */
+@property (atomic, strong) NSArray<NSNumber*>* reencryptConcurrencyLevels;
+/** Number of cold starts to measure for each session cache configuration. `0` to skip this benchmark. Defaults to 5. */
+@property (atomic, assign) NSInteger coldStartIterations;
+/**
+ * Time between the initialization of an instance and its first decryption in cold start benchmarks, standing for the rest of the app launch,
+ * during which SealdSdkOptions.warmUpSessionCount lets the session cache warm up. Applied to every configuration, and not included in the measured time.
+ * Defaults to 0.5 seconds.
+ */
+@property (atomic, assign) NSTimeInterval coldStartLaunchDelay;
+/** The asymmetric key size used by the benchmarked instance. Defaults to 4096. */
+@property (atomic, assign) NSInteger keySize;
+/** Path of the JSON file in which to write the results. If `nil`, results are only returned. */
+@property (atomic, strong, nullable) NSString* outputPath;
+/**
+ * Initialize a SealdBenchmarkOptions instance with default values.
+ *
+ * @param apiUrl The Seald server for the benchmarked instance to use.
+ * @param appId The ID of the app on the Seald server.
+ */
+- (instancetype) initWithApiUrl:(NSString*)apiUrl
+                          appId:(NSString*)appId;
+@end
+
+/**
+ * SealdBenchmarkResult represents the result of a single measurement.
+ */
+@interface SealdBenchmarkResult : NSObject
+/** The name of the measured operation, for example `encryptMessage`. */
+@property (atomic, strong, readonly) NSString* name;
+/** The parameter of the measurement (message size, array size, ...), or `0` if not applicable. */
+@property (atomic, assign, readonly) NSInteger parameter;
+/** The number of iterations that were measured. */
+@property (atomic, assign, readonly) NSInteger iterations;
+/** The total duration of all iterations. */
+@property (atomic, assign, readonly) NSTimeInterval totalTime;
+/** The mean duration of one iteration. */
+@property (atomic, assign, readonly) NSTimeInterval meanTime;
+/** The throughput, in `throughputUnit`. */
+@property (atomic, assign, readonly) double throughput;
+/** The unit of `throughput`: `B/s`, `MB/s`, `op/s` or `keys/s`. */
+@property (atomic, strong, readonly) NSString* throughputUnit;
+/** \cond */
+- (instancetype) initWithName:(NSString*)name
+                    parameter:(NSInteger)parameter
+                   iterations:(NSInteger)iterations
+                    totalTime:(NSTimeInterval)totalTime
+                   throughput:(double)throughput
+               throughputUnit:(NSString*)throughputUnit;
+- (NSDictionary<NSString*, id>*) toDictionary;
+/** \endcond */
+@end
+
+/**
+ * SealdBenchmark measures the performance of the main SDK operations:
+ * message and file encryption, session creation and retrieval, key generation, cold starts, account refreshes,
+ * and the overhead of the bridge with the native core.
+ */
+@interface SealdBenchmark : NSObject
+/** The options of this benchmark. */
+@property (atomic, strong, readonly) SealdBenchmarkOptions* options;
+/**
+ * Initialize a SealdBenchmark instance.
+ *
+ * @param options The options of this benchmark.
+ */
+- (instancetype) initWithOptions:(SealdBenchmarkOptions*)options;
+
+/**
+ * Run all benchmarks, and write the results to `options.outputPath` if set.
+ *
+ * @param error Error pointer.
+ * @return The results of all measurements.
+ */
+- (NSArray<SealdBenchmarkResult*>*) runWithError:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
+
+/**
+ * Run all benchmarks, and write the results to `options.outputPath` if set.
+ *
+ * @param completionHandler A callback called after function execution. This callback takes two arguments, a `NSArray<SealdBenchmarkResult*>*` containing the results, and a `NSError*` that indicates if any error occurred.
+ */
+- (void) runAsyncWithCompletionHandler:(void (^)(NSArray<SealdBenchmarkResult*>* results, NSError*_Nullable error))completionHandler;
+
+/**
+ * Serialize results to a machine-readable JSON file, tagged with the SDK version.
+ *
+ * @param results The results to write.
+ * @param path The path of the file to write.
+ * @param error Error pointer.
+ * @return `YES` if the file was written.
+ */
++ (BOOL) writeResults:(NSArray<SealdBenchmarkResult*>*)results
+               toPath:(NSString*)path
+                error:(NSError*_Nullable*)error;
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* SealdBenchmark_h */
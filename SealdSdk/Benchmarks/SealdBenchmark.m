@@ -0,0 +1,583 @@
+//
+//  SealdBenchmark.m
+//  SealdSdkBenchmarks
+//
+//  Created by Seald SAS on 18/10/2026.
+//  Copyright © 2026 Seald SAS. All rights reserved.
+//
+
+#import <time.h>
+#import "SealdBenchmark.h"
+
+static uint64_t nowNs(void)
+{
+    return clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+}
+
+static NSTimeInterval nsToSeconds(uint64_t ns)
+{
+    return (NSTimeInterval)ns / 1e9;
+}
+
+static NSString* randomAsciiString(NSInteger length)
+{
+    static const char alphabet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    NSMutableData* data = [NSMutableData dataWithLength:length];
+    char* bytes = data.mutableBytes;
+    for (NSInteger i = 0; i < length; i++) {
+        bytes[i] = alphabet[arc4random_uniform(sizeof(alphabet) - 1)];
+    }
+    return [[NSString alloc] initWithData:data encoding:NSASCIIStringEncoding];
+}
+
+static NSData* randomData(NSInteger length)
+{
+    NSMutableData* data = [NSMutableData dataWithLength:length];
+    arc4random_buf(data.mutableBytes, length);
+    return data;
+}
+
+@implementation SealdBenchmarkOptions
+- (instancetype) initWithApiUrl:(NSString*)apiUrl
+                          appId:(NSString*)appId
+{
+    self = [super init];
+    if (self) {
+        _apiUrl = apiUrl;
+        _appId = appId;
+        _signupJwt = nil;
+        _messageSizes = @[@64, @1024, @(16 * 1024), @(256 * 1024)];
+        _fileSizes = @[@(64 * 1024), @(1024 * 1024), @(8 * 1024 * 1024)];
+        _bridgeArraySizes = @[@10, @100, @1000, @10000];
+        _iterations = 20;
+        _keyGenerationIterations = 3;
+        _keySize = 4096;
+        _reencryptKeysCount = 100;
+        _reencryptConcurrencyLevels = @[@1, @2, @4, @8];
+        _coldStartIterations = 5;
+        _coldStartLaunchDelay = 0.5;
+        _outputPath = nil;
+    }
+    return self;
+}
+@end
+
+@implementation SealdBenchmarkResult
+- (instancetype) initWithName:(NSString*)name
+                    parameter:(NSInteger)parameter
+                   iterations:(NSInteger)iterations
+                    totalTime:(NSTimeInterval)totalTime
+                   throughput:(double)throughput
+               throughputUnit:(NSString*)throughputUnit
+{
+    self = [super init];
+    if (self) {
+        _name = name;
+        _parameter = parameter;
+        _iterations = iterations;
+        _totalTime = totalTime;
+        _meanTime = iterations > 0 ? totalTime / iterations : 0;
+        _throughput = throughput;
+        _throughputUnit = throughputUnit;
+    }
+    return self;
+}
+- (NSDictionary<NSString*, id>*) toDictionary
+{
+    return @{
+        @"name": self.name,
+        @"parameter": @(self.parameter),
+        @"iterations": @(self.iterations),
+        @"totalTime": @(self.totalTime),
+        @"meanTime": @(self.meanTime),
+        @"throughput": @(self.throughput),
+        @"throughputUnit": self.throughputUnit
+    };
+}
+@end
+
+@implementation SealdBenchmark
+- (instancetype) initWithOptions:(SealdBenchmarkOptions*)options
+{
+    self = [super init];
+    if (self) {
+        _options = options;
+    }
+    return self;
+}
+
+// Measures `block` over `iterations` runs, and returns the total time in seconds.
+// Stops early and returns -1 if `block` returns NO.
+- (NSTimeInterval) measureIterations:(NSInteger)iterations
+                               block:(BOOL (^)(void))block
+{
+    uint64_t start = nowNs();
+    for (NSInteger i = 0; i < iterations; i++) {
+        @autoreleasepool {
+            if (!block()) {
+                return -1;
+            }
+        }
+    }
+    return nsToSeconds(nowNs() - start);
+}
+
+- (SealdBenchmarkResult*) opResultWithName:(NSString*)name
+                                 parameter:(NSInteger)parameter
+                                iterations:(NSInteger)iterations
+                                 totalTime:(NSTimeInterval)totalTime
+{
+    return [[SealdBenchmarkResult alloc] initWithName:name
+                                            parameter:parameter
+                                           iterations:iterations
+                                            totalTime:totalTime
+                                           throughput:totalTime > 0 ? iterations / totalTime : 0
+                                       throughputUnit:@"op/s"];
+}
+
+- (SealdBenchmarkResult*) bytesResultWithName:(NSString*)name
+                                         size:(NSInteger)size
+                                   iterations:(NSInteger)iterations
+                                    totalTime:(NSTimeInterval)totalTime
+                                         unit:(NSString*)unit
+{
+    double bytesPerSecond = totalTime > 0 ? ((double)size * iterations) / totalTime : 0;
+    double throughput = [unit isEqualToString:@"MB/s"] ? bytesPerSecond / (1024 * 1024) : bytesPerSecond;
+    return [[SealdBenchmarkResult alloc] initWithName:name
+                                            parameter:size
+                                           iterations:iterations
+                                            totalTime:totalTime
+                                           throughput:throughput
+                                       throughputUnit:unit];
+}
+
+// Bridge: conversion of Objective-C collections to and from the native core types, without any network.
+- (void) runBridgeBenchmarksInto:(NSMutableArray<SealdBenchmarkResult*>*)results
+{
+    NSInteger iterations = self.options.iterations;
+    for (NSNumber* sizeNumber in self.options.bridgeArraySizes) {
+        NSInteger size = [sizeNumber integerValue];
+        NSMutableArray<NSString*>* strings = [NSMutableArray arrayWithCapacity:size];
+        NSMutableArray<SealdConnector*>* connectors = [NSMutableArray arrayWithCapacity:size];
+        for (NSInteger i = 0; i < size; i++) {
+            NSString* value = [NSString stringWithFormat:@"user-%ld@example.com", (long)i];
+            [strings addObject:value];
+            [connectors addObject:[[SealdConnector alloc] initWithSealdId:[[NSUUID UUID] UUIDString]
+                                                                     type:@"EM"
+                                                                    value:value
+                                                              connectorId:[[NSUUID UUID] UUIDString]
+                                                                    state:@"VO"]];
+        }
+
+        NSTimeInterval t = [self measureIterations:iterations block:^BOOL {
+            arrayToStringArray(strings);
+            return YES;
+        }];
+        [results addObject:[self opResultWithName:@"bridge.arrayToStringArray" parameter:size iterations:iterations totalTime:t]];
+
+        SealdSdkInternalsMobile_sdkStringArray* mobileStrings = arrayToStringArray(strings);
+        t = [self measureIterations:iterations block:^BOOL {
+            stringArrayToArray(mobileStrings);
+            return YES;
+        }];
+        [results addObject:[self opResultWithName:@"bridge.stringArrayToArray" parameter:size iterations:iterations totalTime:t]];
+
+        t = [self measureIterations:iterations block:^BOOL {
+            [SealdConnector toMobileSdkArray:connectors];
+            return YES;
+        }];
+        [results addObject:[self opResultWithName:@"bridge.connectorsToMobileSdkArray" parameter:size iterations:iterations totalTime:t]];
+
+        SealdSdkInternalsMobile_sdkConnectorsArray* mobileConnectors = [SealdConnector toMobileSdkArray:connectors];
+        t = [self measureIterations:iterations block:^BOOL {
+            [SealdConnector fromMobileSdkArray:mobileConnectors];
+            return YES;
+        }];
+        [results addObject:[self opResultWithName:@"bridge.connectorsFromMobileSdkArray" parameter:size iterations:iterations totalTime:t]];
+    }
+}
+
+- (BOOL) runKeyGenerationBenchmarkWithSdk:(SealdSdk*)sdk
+                                     into:(NSMutableArray<SealdBenchmarkResult*>*)results
+                                    error:(NSError*_Nullable*)error
+{
+    NSInteger iterations = self.options.keyGenerationIterations;
+    __block NSError* localErr = nil;
+    NSTimeInterval t = [self measureIterations:iterations block:^BOOL {
+        NSError* err = nil;
+        [sdk generatePrivateKeysWithError:&err];
+        localErr = err;
+        return err == nil;
+    }];
+    if (localErr) {
+        if (error) *error = localErr;
+        return NO;
+    }
+    [results addObject:[self opResultWithName:@"generatePrivateKeys" parameter:self.options.keySize iterations:iterations totalTime:t]];
+    return YES;
+}
+
+- (BOOL) runSessionBenchmarksWithSdk:(SealdSdk*)sdk
+                                into:(NSMutableArray<SealdBenchmarkResult*>*)results
+                               error:(NSError*_Nullable*)error
+{
+    NSInteger iterations = self.options.iterations;
+    __block NSError* localErr = nil;
+
+    __block SealdEncryptionSession* lastSession = nil;
+    NSTimeInterval t = [self measureIterations:iterations block:^BOOL {
+        NSError* err = nil;
+        lastSession = [sdk createEncryptionSessionWithRecipients:@[] metadata:nil useCache:YES error:&err];
+        localErr = err;
+        return err == nil;
+    }];
+    if (localErr) {
+        if (error) *error = localErr;
+        return NO;
+    }
+    [results addObject:[self opResultWithName:@"createEncryptionSession" parameter:0 iterations:iterations totalTime:t]];
+
+    NSString* sessionId = lastSession.sessionId;
+    t = [self measureIterations:iterations block:^BOOL {
+        NSError* err = nil;
+        [sdk retrieveEncryptionSessionWithSessionId:sessionId useCache:NO lookupProxyKey:NO lookupGroupKey:NO error:&err];
+        localErr = err;
+        return err == nil;
+    }];
+    if (localErr) {
+        if (error) *error = localErr;
+        return NO;
+    }
+    [results addObject:[self opResultWithName:@"retrieveEncryptionSession.cacheMiss" parameter:0 iterations:iterations totalTime:t]];
+
+    // Warm the cache once, so that all measured retrievals hit it.
+    [sdk retrieveEncryptionSessionWithSessionId:sessionId useCache:YES lookupProxyKey:NO lookupGroupKey:NO error:&localErr];
+    if (localErr) {
+        if (error) *error = localErr;
+        return NO;
+    }
+    t = [self measureIterations:iterations block:^BOOL {
+        NSError* err = nil;
+        [sdk retrieveEncryptionSessionWithSessionId:sessionId useCache:YES lookupProxyKey:NO lookupGroupKey:NO error:&err];
+        localErr = err;
+        return err == nil;
+    }];
+    if (localErr) {
+        if (error) *error = localErr;
+        return NO;
+    }
+    [results addObject:[self opResultWithName:@"retrieveEncryptionSession.cacheHit" parameter:0 iterations:iterations totalTime:t]];
+
+    for (NSNumber* sizeNumber in self.options.messageSizes) {
+        NSInteger size = [sizeNumber integerValue];
+        NSString* clearMessage = randomAsciiString(size);
+        __block NSString* encryptedMessage = nil;
+        t = [self measureIterations:iterations block:^BOOL {
+            NSError* err = nil;
+            encryptedMessage = [lastSession encryptMessage:clearMessage error:&err];
+            localErr = err;
+            return err == nil;
+        }];
+        if (localErr) {
+            if (error) *error = localErr;
+            return NO;
+        }
+        [results addObject:[self bytesResultWithName:@"encryptMessage" size:size iterations:iterations totalTime:t unit:@"B/s"]];
+
+        t = [self measureIterations:iterations block:^BOOL {
+            NSError* err = nil;
+            [lastSession decryptMessage:encryptedMessage error:&err];
+            localErr = err;
+            return err == nil;
+        }];
+        if (localErr) {
+            if (error) *error = localErr;
+            return NO;
+        }
+        [results addObject:[self bytesResultWithName:@"decryptMessage" size:size iterations:iterations totalTime:t unit:@"B/s"]];
+    }
+
+    for (NSNumber* sizeNumber in self.options.fileSizes) {
+        NSInteger size = [sizeNumber integerValue];
+        NSData* clearFile = randomData(size);
+        __block NSData* encryptedFile = nil;
+        t = [self measureIterations:iterations block:^BOOL {
+            NSError* err = nil;
+            encryptedFile = [lastSession encryptFile:clearFile filename:@"benchmark.bin" error:&err];
+            localErr = err;
+            return err == nil;
+        }];
+        if (localErr) {
+            if (error) *error = localErr;
+            return NO;
+        }
+        [results addObject:[self bytesResultWithName:@"encryptFile" size:size iterations:iterations totalTime:t unit:@"MB/s"]];
+
+        t = [self measureIterations:iterations block:^BOOL {
+            NSError* err = nil;
+            [lastSession decryptFile:encryptedFile error:&err];
+            localErr = err;
+            return err == nil;
+        }];
+        if (localErr) {
+            if (error) *error = localErr;
+            return NO;
+        }
+        [results addObject:[self bytesResultWithName:@"decryptFile" size:size iterations:iterations totalTime:t unit:@"MB/s"]];
+    }
+    return YES;
+}
+
+// Mass reencrypt: for each concurrency level, as many new sub-identities as the level are created,
+// and the keys of `reencryptKeysCount` sessions are re-encrypted for all of them at once.
+- (BOOL) runMassReencryptBenchmarksWithSdk:(SealdSdk*)sdk
+                                      into:(NSMutableArray<SealdBenchmarkResult*>*)results
+                                     error:(NSError*_Nullable*)error
+{
+    NSError* localErr = nil;
+    NSInteger keysCount = self.options.reencryptKeysCount;
+    if (keysCount <= 0) {
+        return YES;
+    }
+    NSMutableArray<NSArray<SealdRecipientWithRights*>*>* recipientSets = [NSMutableArray arrayWithCapacity:keysCount];
+    for (NSInteger i = 0; i < keysCount; i++) {
+        [recipientSets addObject:@[]];
+    }
+    [sdk createEncryptionSessionsWithRecipientSets:recipientSets metadata:nil useCache:NO error:&localErr];
+    if (localErr) {
+        if (error) *error = localErr;
+        return NO;
+    }
+
+    for (NSNumber* levelNumber in self.options.reencryptConcurrencyLevels) {
+        NSInteger level = [levelNumber integerValue];
+        NSMutableArray<NSString*>* deviceIds = [NSMutableArray arrayWithCapacity:level];
+        for (NSInteger i = 0; i < level; i++) {
+            SealdCreateSubIdentityResponse* subIdentity = [sdk createSubIdentityWithDeviceName:@"benchmark" privateKeys:nil expireAfter:0 error:&localErr];
+            if (localErr) {
+                if (error) *error = localErr;
+                return NO;
+            }
+            [deviceIds addObject:subIdentity.deviceId];
+        }
+        SealdMassReencryptOptions* reencryptOptions = [[SealdMassReencryptOptions alloc] init];
+        reencryptOptions.concurrency = level;
+        uint64_t start = nowNs();
+        SealdMassReencryptDevicesResult* res = [sdk massReencryptWithDeviceIds:deviceIds options:reencryptOptions];
+        NSTimeInterval t = nsToSeconds(nowNs() - start);
+        if ([res.errors count] > 0) {
+            _SealdInternal_SetError(@"BENCHMARK_FAILED", [NSString stringWithFormat:@"massReencrypt failed: %@", [res.errors allValues][0].result], error);
+            return NO;
+        }
+        [results addObject:[[SealdBenchmarkResult alloc] initWithName:@"massReencrypt"
+                                                            parameter:level
+                                                           iterations:res.reencrypted
+                                                            totalTime:t
+                                                           throughput:t > 0 ? res.reencrypted / t : 0
+                                                       throughputUnit:@"keys/s"]];
+    }
+    return YES;
+}
+
+// Cold start: time to initialize a new instance on an existing database, plus time to decrypt the first message after `coldStartLaunchDelay`,
+// without session store, with a session store, and with a session store and warm-up of the memory cache.
+// Without the delay, the first decryption would race the warm-up, and the warm-up configuration would measure contention instead of its benefit.
+- (BOOL) runColdStartBenchmarksWithSdk:(SealdSdk*)sdk
+                                  into:(NSMutableArray<SealdBenchmarkResult*>*)results
+                                 error:(NSError*_Nullable*)error
+{
+    NSError* localErr = nil;
+    NSInteger iterations = self.options.coldStartIterations;
+    if (iterations <= 0) {
+        return YES;
+    }
+    NSData* identity = [sdk exportIdentityWithError:&localErr];
+    if (localErr) {
+        if (error) *error = localErr;
+        return NO;
+    }
+    SealdEncryptionSession* es = [sdk createEncryptionSessionWithRecipients:@[] metadata:nil useCache:NO error:&localErr];
+    if (localErr) {
+        if (error) *error = localErr;
+        return NO;
+    }
+    NSString* encryptedMessage = [es encryptMessage:@"cold start" error:&localErr];
+    if (localErr) {
+        if (error) *error = localErr;
+        return NO;
+    }
+
+    SealdSdkOptions* noStore = [[SealdSdkOptions alloc] init];
+    SealdSdkOptions* store = [[SealdSdkOptions alloc] init];
+    store.sessionStoreMaxEntries = 100;
+    SealdSdkOptions* warmUp = [[SealdSdkOptions alloc] init];
+    warmUp.sessionStoreMaxEntries = 100;
+    warmUp.sessionCacheMaxEntries = 100;
+    warmUp.warmUpSessionCount = 10;
+    NSDictionary<NSString*, SealdSdkOptions*>* configurations = @{@"noStore": noStore, @"store": store, @"warmUp": warmUp};
+
+    NSFileManager* fm = [NSFileManager defaultManager];
+    for (NSString* name in @[@"noStore", @"store", @"warmUp"]) {
+        SealdSdkOptions* sdkOptions = configurations[name];
+        NSString* databasePath = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+        NSData* databaseEncryptionKey = randomData(64);
+        SealdSdk* (^openInstance)(NSError*_Nullable*) = ^SealdSdk* (NSError*_Nullable* err) {
+            return [[SealdSdk alloc] initWithApiUrl:self.options.apiUrl
+                                              appId:self.options.appId
+                                       databasePath:databasePath
+                              databaseEncryptionKey:databaseEncryptionKey
+                                       instanceName:@"SealdBenchmarkColdStart"
+                                           logLevel:0
+                                         logNoColor:YES
+                          encryptionSessionCacheTTL:-1
+                                            keySize:self.options.keySize
+                                            options:sdkOptions
+                                              error:err];
+        };
+
+        // First launch: import the identity, and use the session once, so that it is in the database and in the session store.
+        SealdSdk* firstInstance = openInstance(&localErr);
+        if (!localErr) {
+            [firstInstance importIdentity:identity error:&localErr];
+        }
+        if (!localErr) {
+            [firstInstance retrieveEncryptionSessionFromMessage:encryptedMessage useCache:YES lookupProxyKey:NO lookupGroupKey:NO error:&localErr];
+        }
+        // Closing waits for the session store to finish writing in the background.
+        if (!localErr) {
+            [firstInstance closeWithError:&localErr];
+        }
+        if (localErr) {
+            if (error) *error = localErr;
+            return NO;
+        }
+
+        NSError* iterationErr = nil;
+        uint64_t measuredNs = 0;
+        for (NSInteger i = 0; i < iterations && iterationErr == nil; i++) {
+            @autoreleasepool {
+                uint64_t start = nowNs();
+                SealdSdk* instance = openInstance(&iterationErr);
+                if (iterationErr) {
+                    break;
+                }
+                measuredNs += nowNs() - start;
+                [NSThread sleepForTimeInterval:self.options.coldStartLaunchDelay];
+                start = nowNs();
+                SealdEncryptionSession* session = [instance retrieveEncryptionSessionFromMessage:encryptedMessage useCache:YES lookupProxyKey:NO lookupGroupKey:NO error:&iterationErr];
+                if (!iterationErr) {
+                    [session decryptMessage:encryptedMessage error:&iterationErr];
+                }
+                measuredNs += nowNs() - start;
+                NSError* closeErr = nil;
+                [instance closeWithError:&closeErr];
+                iterationErr = iterationErr ?: closeErr;
+            }
+        }
+        NSTimeInterval t = nsToSeconds(measuredNs);
+
+        [fm removeItemAtPath:databasePath error:nil];
+        [fm removeItemAtPath:[databasePath stringByAppendingString:@"-sessions"] error:nil];
+        [fm removeItemAtPath:[databasePath stringByAppendingString:@"-sessions.manifest"] error:nil];
+        if (iterationErr) {
+            if (error) *error = iterationErr;
+            return NO;
+        }
+        [results addObject:[self opResultWithName:[NSString stringWithFormat:@"coldStartFirstDecrypt.%@", name] parameter:0 iterations:iterations totalTime:t]];
+    }
+    return YES;
+}
+
+- (NSArray<SealdBenchmarkResult*>*) runWithError:(NSError*_Nullable*)error
+{
+    NSMutableArray<SealdBenchmarkResult*>* results = [NSMutableArray array];
+    NSError* localErr = nil;
+
+    [self runBridgeBenchmarksInto:results];
+
+    SealdSdk* sdk = [[SealdSdk alloc] initWithApiUrl:self.options.apiUrl
+                                               appId:self.options.appId
+                                        databasePath:nil
+                               databaseEncryptionKey:nil
+                                        instanceName:@"SealdBenchmark"
+                                            logLevel:0
+                                          logNoColor:YES
+                           encryptionSessionCacheTTL:-1
+                                             keySize:self.options.keySize
+                                               error:&localErr];
+    if (localErr) {
+        if (error) *error = localErr;
+        return nil;
+    }
+
+    if (![self runKeyGenerationBenchmarkWithSdk:sdk into:results error:&localErr]) {
+        if (error) *error = localErr;
+        return nil;
+    }
+
+    if (self.options.signupJwt != nil) {
+        [sdk createAccountWithSignupJwt:self.options.signupJwt deviceName:@"benchmark" displayName:@"benchmark" privateKeys:nil expireAfter:0 error:&localErr];
+        if (localErr) {
+            if (error) *error = localErr;
+            return nil;
+        }
+        if (![self runSessionBenchmarksWithSdk:sdk into:results error:&localErr]) {
+            if (error) *error = localErr;
+            return nil;
+        }
+        if (![self runMassReencryptBenchmarksWithSdk:sdk into:results error:&localErr]) {
+            if (error) *error = localErr;
+            return nil;
+        }
+        if (![self runColdStartBenchmarksWithSdk:sdk into:results error:&localErr]) {
+            if (error) *error = localErr;
+            return nil;
+        }
+    }
+
+    [sdk closeWithError:&localErr];
+    if (localErr) {
+        if (error) *error = localErr;
+        return nil;
+    }
+
+    if (self.options.outputPath != nil) {
+        if (![SealdBenchmark writeResults:results toPath:self.options.outputPath error:&localErr]) {
+            if (error) *error = localErr;
+            return nil;
+        }
+    }
+    return results;
+}
+
+- (void) runAsyncWithCompletionHandler:(void (^)(NSArray<SealdBenchmarkResult*>* results, NSError*_Nullable error))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSError* localErr = nil;
+        NSArray<SealdBenchmarkResult*>* res = [self runWithError:&localErr];
+        completionHandler(res, localErr);
+    });
+}
+
++ (BOOL) writeResults:(NSArray<SealdBenchmarkResult*>*)results
+               toPath:(NSString*)path
+                error:(NSError*_Nullable*)error
+{
+    NSMutableArray<NSDictionary*>* serializedResults = [NSMutableArray arrayWithCapacity:[results count]];
+    for (SealdBenchmarkResult* r in results) {
+        [serializedResults addObject:[r toDictionary]];
+    }
+    NSISO8601DateFormatter* formatter = [[NSISO8601DateFormatter alloc] init];
+    NSDictionary* report = @{
+        @"sdkVersion": SealdSdkVersion,
+        @"date": [formatter stringFromDate:[NSDate date]],
+        @"os": [[NSProcessInfo processInfo] operatingSystemVersionString],
+        @"results": serializedResults
+    };
+    NSData* json = [NSJSONSerialization dataWithJSONObject:report options:NSJSONWritingPrettyPrinted | NSJSONWritingSortedKeys error:error];
+    if (json == nil) {
+        return NO;
+    }
+    return [json writeToFile:path options:NSDataWritingAtomic error:error];
+}
+@end
@@ -0,0 +1,179 @@
+//
+//  SealdMockServer.h
+//  SealdSdkBenchmarks
+//
+//  Created by Seald SAS on 18/10/2026.
+//  Copyright © 2026 Seald SAS. All rights reserved.
+//
+
+#ifndef SealdMockServer_h
+#define SealdMockServer_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * SealdTrafficMode selects whether SealdMockServer records or replays the traffic it serves.
+ * Recording and replay are only available through SealdMockServer, not through SealdSdkOptions: the SDK itself never records its traffic.
+ * To capture the traffic of an app, link SealdSdkBenchmarks in a dedicated build, start a server in `SealdTrafficModeRecord`
+ * with the real API as `upstreamUrl`, and pass its `url` as the `apiUrl` of the SDK instance.
+ */
+typedef NS_ENUM (NSInteger, SealdTrafficMode) {
+    /** Traffic is neither recorded nor replayed. */
+    SealdTrafficModeNone = 0,
+    /** Each request forwarded upstream is appended to the traffic file with its response and timing, as-is: the file holds credentials, and must be redacted with exportRedactedTrafficFile:toPath:error: before being shared. */
+    SealdTrafficModeRecord = 1,
+    /** Requests are answered from the traffic file instead of being forwarded upstream. Each response is sent no earlier than its recorded offset from the start of the session, plus its recorded duration. */
+    SealdTrafficModeReplay = 2,
+};
+
+/**
+ * A handler answering the requests matched by SealdMockServer.stubMethod:pathPattern:handler:. Handlers may be called concurrently.
+ *
+ * @param method The HTTP method of the request.
+ * @param pathParameters The path segments matched by the `*` segments of the pattern, in order.
+ * @param query The query parameters of the request.
+ * @param body The request body parsed as JSON, or `nil` if it is empty or not JSON.
+ * @param responseBody Set to the JSON object to answer with. Left `nil` for an empty body.
+ * @return The HTTP status of the response.
+ */
+typedef NSInteger (^SealdMockServerHandler)(NSString* method,
+                                            NSArray<NSString*>* pathParameters,
+                                            NSDictionary<NSString*, NSString*>* query,
+                                            id _Nullable body,
+                                            id _Nullable* _Nonnull responseBody);
+
+/**
+ * SealdMockServerOptions represents options for SealdMockServer.
+ */
+@interface SealdMockServerOptions : NSObject
+/** The server to which requests that do not match any stub are forwarded, for example a self-hosted Seald API or SSKS. If `nil`, such requests get a `404` response. */
+@property (atomic, strong, nullable) NSString* upstreamUrl;
+/** The port on which to listen, on the loopback interface. `0` to pick a free port. Defaults to `0`. */
+@property (atomic, assign) uint16_t port;
+/** Latency added before answering each request. Defaults to `0`. */
+@property (atomic, assign) NSTimeInterval latency;
+/** Maximum random latency added on top of `latency`. Defaults to `0`. */
+@property (atomic, assign) NSTimeInterval latencyJitter;
+/** Probability, between `0` and `1`, for a request to be answered with `injectedErrorStatus` instead of its normal response. Defaults to `0`. */
+@property (atomic, assign) double errorRate;
+/** HTTP status of injected errors. Defaults to `503`. */
+@property (atomic, assign) NSInteger injectedErrorStatus;
+/** Maximum number of bytes per second sent in each response body. `0` for no limit. Defaults to `0`. */
+@property (atomic, assign) NSInteger bandwidthLimit;
+/** Whether to record or replay traffic. Must be set before starting the server. Defaults to `SealdTrafficModeNone`. */
+@property (atomic, assign) SealdTrafficMode trafficMode;
+/** Path of the traffic file, in JSON lines format, used when `trafficMode` is not `SealdTrafficModeNone`. In record mode, new exchanges are appended to it. */
+@property (atomic, strong, nullable) NSString* trafficFilePath;
+/**
+ * Initialize a SealdMockServerOptions instance with default values.
+ *
+ * @param upstreamUrl The server to which requests that do not match any stub are forwarded.
+ */
+- (instancetype) initWithUpstreamUrl:(const NSString*_Nullable)upstreamUrl;
+@end
+
+/**
+ * SealdMockServer is a local HTTP server to put between an SDK instance and the Seald API or SSKS,
+ * to run load and latency tests with controlled network conditions.
+ * Requests are answered by stubs registered with stubMethod:pathPrefix:status:headers:body: or stubMethod:pathPattern:handler:,
+ * by the in-memory stand-in for the main API and SSKS routes installed by installStandInHandlers,
+ * or forwarded to `options.upstreamUrl`, with configurable injected latency, errors and bandwidth limits.
+ * Pass `url` as `apiUrl` or `ssksURL` to point an SDK instance or a SSKS plugin at it.
+ * A server only sees the traffic sent to its own `url`: to record or replay SSKS traffic as well as API traffic,
+ * run a second server with the SSKS URL as `upstreamUrl` and its own `trafficFilePath`.
+ * Connections are served asynchronously: injected latency and bandwidth limits do not hold a thread.
+ */
+@interface SealdMockServer : NSObject
+/** The options of this server. They can be changed while the server is running. */
+@property (atomic, strong, readonly) SealdMockServerOptions* options;
+/** The URL at which this server listens, or `nil` if it is not started. */
+@property (atomic, strong, readonly, nullable) NSString* url;
+/** The number of requests this server has answered. */
+@property (atomic, assign, readonly) NSInteger requestCount;
+/**
+ * Initialize a SealdMockServer instance.
+ *
+ * @param options The options of this server.
+ */
+- (instancetype) initWithOptions:(SealdMockServerOptions*)options;
+
+/**
+ * Start listening.
+ *
+ * @param error Error pointer.
+ * @return `YES` if the server is listening.
+ */
+- (BOOL) startWithError:(NSError*_Nullable*)error;
+
+/**
+ * Stop listening, and close all open connections.
+ */
+- (void) stop;
+
+/**
+ * Answer requests matching the given method and path prefix with a fixed response.
+ * When multiple stubs match, the most recently added one is used.
+ *
+ * @param method The HTTP method to match, or `nil` to match any method.
+ * @param pathPrefix The prefix of the request path to match, for example `/api/`.
+ * @param status The HTTP status of the response.
+ * @param headers The headers of the response.
+ * @param body The body of the response.
+ */
+- (void) stubMethod:(const NSString*_Nullable)method
+         pathPrefix:(const NSString*)pathPrefix
+             status:(NSInteger)status
+            headers:(const NSDictionary<NSString*, NSString*>*_Nullable)headers
+               body:(const NSData*_Nullable)body;
+
+/**
+ * Answer requests matching the given method and path pattern with a handler.
+ * Patterns are matched segment by segment, ignoring trailing slashes, and a `*` segment matches any single segment.
+ * When multiple stubs match, the most recently added one is used.
+ *
+ * @param method The HTTP method to match, or `nil` to match any method.
+ * @param pathPattern The pattern of the request path to match.
+ * @param handler The handler answering matched requests.
+ */
+- (void) stubMethod:(const NSString*_Nullable)method
+        pathPattern:(const NSString*)pathPattern
+            handler:(SealdMockServerHandler)handler;
+
+/**
+ * Install handlers standing in for the API and SSKS in the flows used by load and latency tests, so that they can run without any upstream.
+ * Their state is kept in memory, and shared by all the routes of this server. `{id}` stands for any single path segment:
+ * - encryption sessions: `POST /api/message/` creates a session with the keys of `encrypted_message_keys`, `GET /api/message/{id}/` returns the key
+ *   of the device given by the `created_for_key` query parameter, and `POST /api/message/{id}/add_key/` adds keys;
+ * - group members: `GET /api/group/{id}/members/`, `POST /api/group/{id}/add_members/` and `POST /api/group/{id}/remove_members/`;
+ * - mass re-encryption: `GET /api/device/{id}/missing_message_keys/` lists the sessions without a key for the device, and `POST /api/device/{id}/add_message_keys/` adds them;
+ * - SSKS: `POST /strict/push` and `POST /strict/search` for the password plugin, `POST /tmr/back/key/` and `POST /tmr/front/search/` for the TMR plugin.
+ * Keys are stored as sent: signatures, sigchains and authentication are not checked, so this measures the client side of these flows only.
+ * Stubs added afterwards take precedence over these handlers.
+ */
+- (void) installStandInHandlers;
+
+/**
+ * Remove all stubs, including the stand-in handlers.
+ */
+- (void) removeAllStubs;
+
+/**
+ * Copy a traffic file recorded with `SealdTrafficModeRecord`, with credentials redacted, so that it can be shared.
+ * Secret headers and secret fields of JSON bodies are replaced by `REDACTED`, and non-JSON bodies are replaced entirely.
+ * The redacted copy can still be replayed, but only for requests whose responses do not need the redacted values.
+ *
+ * @param path The path of the recorded traffic file.
+ * @param redactedPath The path at which to write the redacted copy.
+ * @param error Error pointer.
+ * @return `YES` if the redacted copy was written.
+ */
++ (BOOL) exportRedactedTrafficFile:(const NSString*)path
+                            toPath:(const NSString*)redactedPath
+                             error:(NSError*_Nullable*)error;
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* SealdMockServer_h */
@@ -0,0 +1,1166 @@
+//
+//  SealdMockServer.m
+//  SealdSdkBenchmarks
+//
+//  Created by Seald SAS on 18/10/2026.
+//  Copyright © 2026 Seald SAS. All rights reserved.
+//
+
+#import <sys/socket.h>
+#import <netinet/in.h>
+#import <arpa/inet.h>
+#import <unistd.h>
+#import <time.h>
+#import "SealdMockServer.h"
+@import SealdSdk;
+
+static const NSUInteger maxHeaderSize = 64 * 1024;
+static const NSUInteger maxBodySize = 256 * 1024 * 1024;
+
+static double randomUnit(void)
+{
+    return (double)arc4random_uniform(1000000) / 1000000.0;
+}
+
+static NSString* reasonPhraseForStatus(NSInteger status)
+{
+    switch (status) {
+        case 200: return @"OK";
+        case 201: return @"Created";
+        case 204: return @"No Content";
+        case 400: return @"Bad Request";
+        case 401: return @"Unauthorized";
+        case 403: return @"Forbidden";
+        case 404: return @"Not Found";
+        case 429: return @"Too Many Requests";
+        case 500: return @"Internal Server Error";
+        case 502: return @"Bad Gateway";
+        case 503: return @"Service Unavailable";
+        case 504: return @"Gateway Timeout";
+        default: return @"Status";
+    }
+}
+
+static NSSet<NSString*>* hopByHopHeaders(void)
+{
+    static NSSet<NSString*>* headers = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        headers = [NSSet setWithArray:@[@"connection", @"keep-alive", @"transfer-encoding", @"content-length", @"content-encoding", @"host", @"expect", @"upgrade", @"proxy-connection", @"te", @"trailer"]];
+    });
+    return headers;
+}
+
+static NSString*const redactedValue = @"REDACTED";
+
+static BOOL isSecretHeader(NSString* name)
+{
+    NSString* lower = [name lowercaseString];
+    return [lower isEqualToString:@"authorization"] || [lower isEqualToString:@"cookie"] || [lower isEqualToString:@"set-cookie"] || [lower containsString:@"token"];
+}
+
+static BOOL isSecretJsonKey(NSString* key)
+{
+    NSString* lower = [key lowercaseString];
+    for (NSString* secret in @[@"password", @"secret", @"token", @"jwt", @"challenge", @"rawkey", @"twomanrule"]) {
+        if ([lower containsString:secret]) {
+            return YES;
+        }
+    }
+    return NO;
+}
+
+static id redactJsonObject(id object)
+{
+    if ([object isKindOfClass:[NSDictionary class]]) {
+        NSMutableDictionary* res = [NSMutableDictionary dictionaryWithCapacity:[object count]];
+        for (NSString* key in object) {
+            res[key] = isSecretJsonKey(key) ? redactedValue : redactJsonObject(object[key]);
+        }
+        return res;
+    }
+    if ([object isKindOfClass:[NSArray class]]) {
+        NSMutableArray* res = [NSMutableArray arrayWithCapacity:[object count]];
+        for (id item in object) {
+            [res addObject:redactJsonObject(item)];
+        }
+        return res;
+    }
+    return object;
+}
+
+// JSON bodies are exported with secret fields redacted. Other bodies cannot be inspected, so they are replaced entirely.
+static NSString* redactedBody(NSString* base64Body)
+{
+    NSData* body = [[NSData alloc] initWithBase64EncodedString:base64Body ?: @"" options:0];
+    if ([body length] == 0) {
+        return @"";
+    }
+    id json = [NSJSONSerialization JSONObjectWithData:body options:NSJSONReadingFragmentsAllowed error:nil];
+    if (json != nil) {
+        NSData* redacted = [NSJSONSerialization dataWithJSONObject:redactJsonObject(json) options:NSJSONWritingFragmentsAllowed error:nil];
+        if (redacted != nil) {
+            return [redacted base64EncodedStringWithOptions:0];
+        }
+    }
+    return [[redactedValue dataUsingEncoding:NSUTF8StringEncoding] base64EncodedStringWithOptions:0];
+}
+
+static NSDictionary<NSString*, NSString*>* redactedHeaders(NSDictionary<NSString*, NSString*>* headers)
+{
+    NSMutableDictionary<NSString*, NSString*>* res = [NSMutableDictionary dictionaryWithCapacity:[headers count]];
+    for (NSString* name in headers) {
+        res[name] = isSecretHeader(name) ? redactedValue : headers[name];
+    }
+    return res;
+}
+
+@interface SealdMockServerRequest : NSObject
+@property (atomic, strong) NSString* method;
+@property (atomic, strong) NSString* target;
+@property (atomic, strong) NSDictionary<NSString*, NSString*>* headers; // lowercased names
+@property (atomic, strong) NSData* body;
+@end
+
+@implementation SealdMockServerRequest
+@end
+
+@interface SealdMockServerResponse : NSObject
+@property (atomic, assign) NSInteger status;
+@property (atomic, strong) NSDictionary<NSString*, NSString*>* headers;
+@property (atomic, strong) NSData* body;
+- (instancetype) initWithStatus:(NSInteger)status
+                        headers:(NSDictionary<NSString*, NSString*>*)headers
+                           body:(NSData*)body;
++ (instancetype) jsonResponseWithStatus:(NSInteger)status
+                                   code:(NSString*)code
+                                message:(NSString*)message;
+@end
+
+@implementation SealdMockServerResponse
+- (instancetype) initWithStatus:(NSInteger)status
+                        headers:(NSDictionary<NSString*, NSString*>*)headers
+                           body:(NSData*)body
+{
+    self = [super init];
+    if (self) {
+        _status = status;
+        _headers = headers;
+        _body = body;
+    }
+    return self;
+}
++ (instancetype) jsonResponseWithStatus:(NSInteger)status
+                                   code:(NSString*)code
+                                message:(NSString*)message
+{
+    NSData* body = [NSJSONSerialization dataWithJSONObject:@{@"code": code, @"detail": message} options:0 error:nil];
+    return [[SealdMockServerResponse alloc] initWithStatus:status headers:@{@"Content-Type": @"application/json"} body:body];
+}
+@end
+
+// Either a fixed `response` for the requests whose path starts with `pathPrefix`,
+// or a `handler` for the requests whose path matches `patternSegments`.
+@interface SealdMockServerStub : NSObject
+@property (atomic, strong, nullable) NSString* method;
+@property (atomic, strong, nullable) NSString* pathPrefix;
+@property (atomic, strong, nullable) SealdMockServerResponse* response;
+@property (atomic, strong, nullable) NSArray<NSString*>* patternSegments;
+@property (atomic, copy, nullable) SealdMockServerHandler handler;
+@end
+
+@implementation SealdMockServerStub
+@end
+
+@implementation SealdMockServerOptions
+- (instancetype) initWithUpstreamUrl:(const NSString*_Nullable)upstreamUrl
+{
+    self = [super init];
+    if (self) {
+        _upstreamUrl = (NSString*)upstreamUrl;
+        _port = 0;
+        _latency = 0;
+        _latencyJitter = 0;
+        _errorRate = 0;
+        _injectedErrorStatus = 503;
+        _bandwidthLimit = 0;
+        _trafficMode = SealdTrafficModeNone;
+        _trafficFilePath = nil;
+    }
+    return self;
+}
+@end
+
+static NSArray<NSString*>* pathSegments(NSString* path)
+{
+    NSMutableArray<NSString*>* res = [NSMutableArray array];
+    for (NSString* segment in [path componentsSeparatedByString:@"/"]) {
+        if ([segment length] > 0) {
+            [res addObject:segment];
+        }
+    }
+    return res;
+}
+
+// Returns the segments matched by the `*` segments of `pattern`, or `nil` if `path` does not match it.
+static NSArray<NSString*>* matchPathPattern(NSArray<NSString*>* pattern, NSArray<NSString*>* path)
+{
+    if ([pattern count] != [path count]) {
+        return nil;
+    }
+    NSMutableArray<NSString*>* parameters = [NSMutableArray array];
+    for (NSUInteger i = 0; i < [pattern count]; i++) {
+        if ([pattern[i] isEqualToString:@"*"]) {
+            [parameters addObject:[path[i] stringByRemovingPercentEncoding] ?: path[i]];
+        } else if (![pattern[i] isEqualToString:path[i]]) {
+            return nil;
+        }
+    }
+    return parameters;
+}
+
+static NSDictionary<NSString*, NSString*>* queryParameters(NSString* target)
+{
+    NSMutableDictionary<NSString*, NSString*>* res = [NSMutableDictionary dictionary];
+    for (NSURLQueryItem* item in [NSURLComponents componentsWithString:target].queryItems) {
+        res[item.name] = item.value ?: @"";
+    }
+    return res;
+}
+
+#pragma mark - HTTP/1.1 parsing
+
+static NSData* crlfData(void)
+{
+    static NSData* data = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        data = [@"\r\n" dataUsingEncoding:NSASCIIStringEncoding];
+    });
+    return data;
+}
+
+// Returns the value of a Content-Length header, or -1 if it is not a plain decimal number of at most `maxBodySize`.
+static long long parseContentLength(NSString* value)
+{
+    NSCharacterSet* nonDigits = [[NSCharacterSet characterSetWithCharactersInString:@"0123456789"] invertedSet];
+    if ([value length] == 0 || [value length] > 12 || [value rangeOfCharacterFromSet:nonDigits].location != NSNotFound) {
+        return -1;
+    }
+    long long res = [value longLongValue];
+    return res <= (long long)maxBodySize ? res : -1;
+}
+
+// Returns the size of a chunk from its size line, ignoring chunk extensions, or -1 if it is not a hexadecimal number of at most `maxBodySize`.
+static long long parseChunkSize(NSString* line)
+{
+    NSString* value = [[[line componentsSeparatedByString:@";"] firstObject] stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]];
+    NSCharacterSet* nonHexDigits = [[NSCharacterSet characterSetWithCharactersInString:@"0123456789abcdefABCDEF"] invertedSet];
+    if ([value length] == 0 || [value length] > 8 || [value rangeOfCharacterFromSet:nonHexDigits].location != NSNotFound) {
+        return -1;
+    }
+    long long res = strtoll([value UTF8String], NULL, 16);
+    return res <= (long long)maxBodySize ? res : -1;
+}
+
+// Parses the chunked body starting at `start` in `buffer`. Returns the body and sets `end` to the index after it,
+// or returns `nil`, with `invalid` set if the body is malformed, or unset if more data is needed.
+static NSData* parseChunkedBody(NSData* buffer, NSUInteger start, NSUInteger* end, BOOL* invalid)
+{
+    NSMutableData* body = [NSMutableData data];
+    NSUInteger pos = start;
+    NSUInteger length = [buffer length];
+    while (YES) {
+        NSRange lineEnd = [buffer rangeOfData:crlfData() options:0 range:NSMakeRange(pos, length - pos)];
+        if (lineEnd.location == NSNotFound) {
+            *invalid = length - pos > maxHeaderSize;
+            return nil;
+        }
+        NSString* sizeLine = [[NSString alloc] initWithData:[buffer subdataWithRange:NSMakeRange(pos, lineEnd.location - pos)] encoding:NSASCIIStringEncoding];
+        long long chunkSize = sizeLine != nil ? parseChunkSize(sizeLine) : -1;
+        if (chunkSize < 0 || [body length] + (NSUInteger)chunkSize > maxBodySize) {
+            *invalid = YES;
+            return nil;
+        }
+        pos = NSMaxRange(lineEnd);
+        if (chunkSize == 0) {
+            // Skip trailers, up to the final empty line.
+            while (YES) {
+                lineEnd = [buffer rangeOfData:crlfData() options:0 range:NSMakeRange(pos, length - pos)];
+                if (lineEnd.location == NSNotFound) {
+                    *invalid = length - pos > maxHeaderSize;
+                    return nil;
+                }
+                BOOL emptyLine = lineEnd.location == pos;
+                pos = NSMaxRange(lineEnd);
+                if (emptyLine) {
+                    *end = pos;
+                    return body;
+                }
+            }
+        }
+        if (length < pos + (NSUInteger)chunkSize + 2) {
+            return nil;
+        }
+        [body appendData:[buffer subdataWithRange:NSMakeRange(pos, (NSUInteger)chunkSize)]];
+        pos += (NSUInteger)chunkSize + 2;
+    }
+}
+
+// Parses the first request of `buffer`, and removes it from the buffer. Returns `nil` if the buffer does not hold a full request yet,
+// with `invalid` set if what it holds is not a valid request, and `wantsContinue` set if the client waits for `100 Continue` to send the body.
+static SealdMockServerRequest* parseRequest(NSMutableData* buffer, BOOL* invalid, BOOL* wantsContinue)
+{
+    *invalid = NO;
+    *wantsContinue = NO;
+    NSData* headerEnd = [@"\r\n\r\n" dataUsingEncoding:NSASCIIStringEncoding];
+    NSRange headerEndRange = [buffer rangeOfData:headerEnd options:0 range:NSMakeRange(0, [buffer length])];
+    if (headerEndRange.location == NSNotFound) {
+        *invalid = [buffer length] > maxHeaderSize;
+        return nil;
+    }
+    NSString* head = [[NSString alloc] initWithData:[buffer subdataWithRange:NSMakeRange(0, headerEndRange.location)] encoding:NSISOLatin1StringEncoding];
+    NSArray<NSString*>* lines = [head componentsSeparatedByString:@"\r\n"];
+    NSArray<NSString*>* requestLine = [lines[0] componentsSeparatedByString:@" "];
+    if ([requestLine count] != 3) {
+        *invalid = YES;
+        return nil;
+    }
+    SealdMockServerRequest* request = [[SealdMockServerRequest alloc] init];
+    request.method = [requestLine[0] uppercaseString];
+    request.target = requestLine[1];
+
+    NSMutableDictionary<NSString*, NSString*>* headers = [NSMutableDictionary dictionary];
+    for (NSUInteger i = 1; i < [lines count]; i++) {
+        NSRange colon = [lines[i] rangeOfString:@":"];
+        if (colon.location == NSNotFound) {
+            continue;
+        }
+        NSString* name = [[lines[i] substringToIndex:colon.location] lowercaseString];
+        NSString* value = [[lines[i] substringFromIndex:colon.location + 1] stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]];
+        headers[name] = value;
+    }
+    request.headers = headers;
+
+    NSUInteger bodyStart = NSMaxRange(headerEndRange);
+    NSUInteger requestEnd = 0;
+    NSString* transferEncoding = headers[@"transfer-encoding"];
+    if (transferEncoding != nil && [transferEncoding rangeOfString:@"chunked" options:NSCaseInsensitiveSearch].location != NSNotFound) {
+        request.body = parseChunkedBody(buffer, bodyStart, &requestEnd, invalid);
+    } else {
+        long long contentLength = headers[@"content-length"] != nil ? parseContentLength(headers[@"content-length"]) : 0;
+        if (contentLength < 0) {
+            *invalid = YES;
+            return nil;
+        }
+        requestEnd = bodyStart + (NSUInteger)contentLength;
+        request.body = [buffer length] >= requestEnd ? [buffer subdataWithRange:NSMakeRange(bodyStart, (NSUInteger)contentLength)] : nil;
+    }
+    if (request.body == nil) {
+        NSString* expect = headers[@"expect"];
+        *wantsContinue = !*invalid && expect != nil && [expect caseInsensitiveCompare:@"100-continue"] == NSOrderedSame;
+        return nil;
+    }
+    [buffer replaceBytesInRange:NSMakeRange(0, requestEnd) withBytes:NULL length:0];
+    return request;
+}
+
+#pragma mark - Connections
+
+@class SealdMockServerConnection;
+
+@interface SealdMockServer ()
+- (void) _respondToRequest:(SealdMockServerRequest*)request
+                completion:(void (^)(SealdMockServerResponse* response))completion;
+- (void) _connectionDidClose:(SealdMockServerConnection*)connection;
+@end
+
+// A client connection. Reads and writes are asynchronous, and all its state is only used on its serial `queue`.
+@interface SealdMockServerConnection : NSObject
+- (instancetype) initWithSocket:(int)fd
+                         server:(SealdMockServer*)server;
+- (void) start;
+- (void) close;
+@end
+
+@implementation SealdMockServerConnection {
+    __weak SealdMockServer* server;
+    dispatch_queue_t queue;
+    dispatch_io_t channel;
+    NSMutableData* buffer;
+    // A request is being answered: requests pipelined behind it wait in `buffer`.
+    BOOL busy;
+    // The client closed its side of the connection, or reading failed.
+    BOOL readDone;
+    // `100 Continue` was already sent for the request being received.
+    BOOL sentContinue;
+    BOOL closed;
+}
+
+- (instancetype) initWithSocket:(int)fd
+                         server:(SealdMockServer*)mockServer
+{
+    self = [super init];
+    if (self) {
+        server = mockServer;
+        queue = dispatch_queue_create("io.seald.SealdMockServer.connection", DISPATCH_QUEUE_SERIAL);
+        channel = dispatch_io_create(DISPATCH_IO_STREAM, fd, queue, ^(int err) {
+            close(fd);
+        });
+        dispatch_io_set_low_water(channel, 1);
+        buffer = [NSMutableData data];
+    }
+    return self;
+}
+
+- (void) start
+{
+    dispatch_io_read(channel, 0, SIZE_MAX, queue, ^(bool done, dispatch_data_t data, int err) {
+        if (data != nil) {
+            dispatch_data_apply(data, ^bool (dispatch_data_t region, size_t offset, const void* bytes, size_t size) {
+                [self->buffer appendBytes:bytes length:size];
+                return true;
+            });
+        }
+        if (done) {
+            self->readDone = YES;
+        }
+        [self _processBuffer];
+    });
+}
+
+- (void) close
+{
+    dispatch_async(queue, ^{
+        [self _closeOnQueue];
+    });
+}
+
+// Must be called on `queue`.
+- (void) _closeOnQueue
+{
+    if (closed) {
+        return;
+    }
+    closed = YES;
+    dispatch_io_close(channel, DISPATCH_IO_STOP);
+    [server _connectionDidClose:self];
+}
+
+// Must be called on `queue`. Answers the next complete request of `buffer`, if no request is being answered.
+- (void) _processBuffer
+{
+    if (closed || busy) {
+        return;
+    }
+    BOOL invalid = NO;
+    BOOL wantsContinue = NO;
+    SealdMockServerRequest* request = parseRequest(buffer, &invalid, &wantsContinue);
+    if (invalid) {
+        busy = YES;
+        SealdMockServerResponse* response = [SealdMockServerResponse jsonResponseWithStatus:400 code:@"MOCK_SERVER_BAD_REQUEST" message:@"Malformed request"];
+        [self _writeResponse:response forRequest:nil completion:^(BOOL ok) {
+            [self _closeOnQueue];
+        }];
+        return;
+    }
+    if (request == nil) {
+        if (wantsContinue && !sentContinue) {
+            sentContinue = YES;
+            [self _writeData:[@"HTTP/1.1 100 Continue\r\n\r\n" dataUsingEncoding:NSASCIIStringEncoding] completion:nil];
+        }
+        if (readDone) {
+            [self _closeOnQueue];
+        }
+        return;
+    }
+    sentContinue = NO;
+    SealdMockServer* strongServer = server;
+    if (strongServer == nil) {
+        [self _closeOnQueue];
+        return;
+    }
+    busy = YES;
+    [strongServer _respondToRequest:request completion:^(SealdMockServerResponse* response) {
+        dispatch_async(self->queue, ^{
+            [self _writeResponse:response forRequest:request completion:^(BOOL ok) {
+                self->busy = NO;
+                NSString* connection = request.headers[@"connection"];
+                if (!ok || (connection != nil && [connection caseInsensitiveCompare:@"close"] == NSOrderedSame)) {
+                    [self _closeOnQueue];
+                    return;
+                }
+                [self _processBuffer];
+            }];
+        });
+    }];
+}
+
+// Must be called on `queue`. Calls `completion` on `queue`.
+- (void) _writeData:(NSData*)data
+         completion:(void (^_Nullable)(BOOL ok))completion
+{
+    dispatch_data_t dispatchData = dispatch_data_create([data bytes], [data length], queue, DISPATCH_DATA_DESTRUCTOR_DEFAULT);
+    dispatch_io_write(channel, 0, dispatchData, queue, ^(bool done, dispatch_data_t remaining, int err) {
+        if (done && completion) {
+            completion(err == 0);
+        }
+    });
+}
+
+// Must be called on `queue`. Calls `completion` on `queue`.
+- (void) _writeResponse:(SealdMockServerResponse*)response
+             forRequest:(SealdMockServerRequest*_Nullable)request
+             completion:(void (^)(BOOL ok))completion
+{
+    NSMutableString* head = [NSMutableString stringWithFormat:@"HTTP/1.1 %ld %@\r\n", (long)response.status, reasonPhraseForStatus(response.status)];
+    for (NSString* name in response.headers) {
+        if (![hopByHopHeaders() containsObject:[name lowercaseString]]) {
+            [head appendFormat:@"%@: %@\r\n", name, response.headers[name]];
+        }
+    }
+    [head appendFormat:@"Content-Length: %lu\r\n\r\n", (unsigned long)[response.body length]];
+    NSMutableData* data = [[head dataUsingEncoding:NSISOLatin1StringEncoding] mutableCopy];
+    if ([request.method isEqualToString:@"HEAD"]) {
+        [self _writeData:data completion:completion];
+        return;
+    }
+    NSInteger limit = server.options.bandwidthLimit;
+    if (limit <= 0) {
+        [data appendData:response.body];
+        [self _writeData:data completion:completion];
+        return;
+    }
+    [self _writeData:data completion:^(BOOL ok) {
+        if (!ok) {
+            completion(NO);
+            return;
+        }
+        [self _writeBody:response.body from:0 limit:limit completion:completion];
+    }];
+}
+
+// Must be called on `queue`. Sends `body` from `offset` in slices of a tenth of the allowed bandwidth,
+// waiting after each one so that the average rate stays under the limit.
+- (void) _writeBody:(NSData*)body
+               from:(NSUInteger)offset
+              limit:(NSInteger)limit
+         completion:(void (^)(BOOL ok))completion
+{
+    if (offset >= [body length]) {
+        completion(YES);
+        return;
+    }
+    NSUInteger n = MIN(MAX((NSUInteger)(limit / 10), 1), [body length] - offset);
+    [self _writeData:[body subdataWithRange:NSMakeRange(offset, n)] completion:^(BOOL ok) {
+        if (!ok) {
+            completion(NO);
+            return;
+        }
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)((double)n / (double)limit * NSEC_PER_SEC)), self->queue, ^{
+            [self _writeBody:body from:offset + n limit:limit completion:completion];
+        });
+    }];
+}
+@end
+
+#pragma mark - Server
+
+@implementation SealdMockServer {
+    int listenSocket;
+    dispatch_source_t acceptSource;
+    NSMutableSet<SealdMockServerConnection*>* connections;
+    NSMutableArray<SealdMockServerStub*>* stubs;
+    NSURLSession* upstreamSession;
+    NSFileHandle* trafficFileHandle;
+    uint64_t trafficStartTime;
+    NSMutableDictionary<NSString*, NSMutableArray<NSDictionary*>*>* replayEntries;
+}
+
+- (instancetype) initWithOptions:(SealdMockServerOptions*)options
+{
+    self = [super init];
+    if (self) {
+        _options = options;
+        _url = nil;
+        _requestCount = 0;
+        listenSocket = -1;
+        connections = [NSMutableSet set];
+        stubs = [NSMutableArray array];
+
+        NSURLSessionConfiguration* config = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+        config.URLCache = nil;
+        config.requestCachePolicy = NSURLRequestReloadIgnoringLocalCacheData;
+        config.HTTPShouldSetCookies = NO;
+        config.HTTPCookieStorage = nil;
+        config.HTTPMaximumConnectionsPerHost = 16;
+        upstreamSession = [NSURLSession sessionWithConfiguration:config];
+    }
+    return self;
+}
+
+- (void) dealloc
+{
+    [self stop];
+    [upstreamSession invalidateAndCancel];
+}
+
+- (BOOL) startWithError:(NSError*_Nullable*)error
+{
+    @synchronized (self) {
+        if (listenSocket >= 0) {
+            return YES;
+        }
+        if (![self _openTrafficFileWithError:error]) {
+            return NO;
+        }
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) {
+            _SealdInternal_SetError(@"MOCK_SERVER_SOCKET", [NSString stringWithUTF8String:strerror(errno)], error);
+            return NO;
+        }
+        int yes = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_len = sizeof(addr);
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(self.options.port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, 128) != 0) {
+            _SealdInternal_SetError(@"MOCK_SERVER_BIND", [NSString stringWithUTF8String:strerror(errno)], error);
+            close(fd);
+            return NO;
+        }
+        socklen_t addrLen = sizeof(addr);
+        getsockname(fd, (struct sockaddr*)&addr, &addrLen);
+
+        listenSocket = fd;
+        _url = [NSString stringWithFormat:@"http://127.0.0.1:%u/", ntohs(addr.sin_port)];
+
+        __weak SealdMockServer* weakSelf = self;
+        acceptSource = dispatch_source_create(DISPATCH_SOURCE_TYPE_READ, fd, 0, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0));
+        dispatch_source_set_event_handler(acceptSource, ^{
+            int client = accept(fd, NULL, NULL);
+            if (client < 0) {
+                return;
+            }
+            SealdMockServer* strongSelf = weakSelf;
+            if (strongSelf == nil) {
+                close(client);
+                return;
+            }
+            [strongSelf _acceptClient:client];
+        });
+        dispatch_source_set_cancel_handler(acceptSource, ^{
+            close(fd);
+        });
+        dispatch_resume(acceptSource);
+    }
+    return YES;
+}
+
+- (void) stop
+{
+    @synchronized (self) {
+        if (listenSocket < 0) {
+            return;
+        }
+        dispatch_source_cancel(acceptSource);
+        acceptSource = nil;
+        listenSocket = -1;
+        _url = nil;
+        [trafficFileHandle closeFile];
+        trafficFileHandle = nil;
+    }
+    NSArray<SealdMockServerConnection*>* openConnections = nil;
+    @synchronized (connections) {
+        openConnections = [connections allObjects];
+    }
+    for (SealdMockServerConnection* connection in openConnections) {
+        [connection close];
+    }
+}
+
+- (void) stubMethod:(const NSString*_Nullable)method
+         pathPrefix:(const NSString*)pathPrefix
+             status:(NSInteger)status
+            headers:(const NSDictionary<NSString*, NSString*>*_Nullable)headers
+               body:(const NSData*_Nullable)body
+{
+    SealdMockServerStub* stub = [[SealdMockServerStub alloc] init];
+    stub.method = [(NSString*)method uppercaseString];
+    stub.pathPrefix = (NSString*)pathPrefix;
+    stub.response = [[SealdMockServerResponse alloc] initWithStatus:status headers:(NSDictionary*)headers ?: @{} body:(NSData*)body ?: [NSData data]];
+    @synchronized (stubs) {
+        [stubs addObject:stub];
+    }
+}
+
+- (void) stubMethod:(const NSString*_Nullable)method
+        pathPattern:(const NSString*)pathPattern
+            handler:(SealdMockServerHandler)handler
+{
+    SealdMockServerStub* stub = [[SealdMockServerStub alloc] init];
+    stub.method = [(NSString*)method uppercaseString];
+    stub.patternSegments = pathSegments((NSString*)pathPattern);
+    stub.handler = handler;
+    @synchronized (stubs) {
+        [stubs addObject:stub];
+    }
+}
+
+- (void) removeAllStubs
+{
+    @synchronized (stubs) {
+        [stubs removeAllObjects];
+    }
+}
+
+- (void) _acceptClient:(int)client
+{
+    int yes = 1;
+    setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, &yes, sizeof(yes));
+    SealdMockServerConnection* connection = [[SealdMockServerConnection alloc] initWithSocket:client server:self];
+    @synchronized (connections) {
+        [connections addObject:connection];
+    }
+    [connection start];
+}
+
+- (void) _connectionDidClose:(SealdMockServerConnection*)connection
+{
+    @synchronized (connections) {
+        [connections removeObject:connection];
+    }
+}
+
+#pragma mark - Request handling
+
+- (void) _respondToRequest:(SealdMockServerRequest*)request
+                completion:(void (^)(SealdMockServerResponse* response))completion
+{
+    @synchronized (self) {
+        _requestCount++;
+    }
+    SealdMockServerOptions* opts = self.options;
+    NSTimeInterval delay = opts.latency + opts.latencyJitter * randomUnit();
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+        [self _answerRequest:request completion:completion];
+    });
+}
+
+- (void) _answerRequest:(SealdMockServerRequest*)request
+             completion:(void (^)(SealdMockServerResponse* response))completion
+{
+    SealdMockServerOptions* opts = self.options;
+    if (opts.errorRate > 0 && randomUnit() < opts.errorRate) {
+        completion([SealdMockServerResponse jsonResponseWithStatus:opts.injectedErrorStatus code:@"MOCK_SERVER_INJECTED_ERROR" message:@"Error injected by SealdMockServer"]);
+        return;
+    }
+
+    NSString* path = [[request.target componentsSeparatedByString:@"?"] firstObject];
+    NSArray<NSString*>* segments = pathSegments(path);
+    SealdMockServerResponse* stubResponse = nil;
+    SealdMockServerHandler handler = nil;
+    NSArray<NSString*>* pathParameters = nil;
+    @synchronized (stubs) {
+        for (SealdMockServerStub* stub in [stubs reverseObjectEnumerator]) {
+            if (stub.method != nil && ![stub.method isEqualToString:request.method]) {
+                continue;
+            }
+            if (stub.handler != nil) {
+                pathParameters = matchPathPattern(stub.patternSegments, segments);
+                if (pathParameters != nil) {
+                    handler = stub.handler;
+                    break;
+                }
+            } else if ([path hasPrefix:stub.pathPrefix]) {
+                stubResponse = stub.response;
+                break;
+            }
+        }
+    }
+    if (handler != nil) {
+        id body = [request.body length] > 0 ? [NSJSONSerialization JSONObjectWithData:request.body options:0 error:nil] : nil;
+        id responseBody = nil;
+        NSInteger status = handler(request.method, pathParameters, queryParameters(request.target), body, &responseBody);
+        NSData* responseData = responseBody != nil ? [NSJSONSerialization dataWithJSONObject:responseBody options:0 error:nil] : nil;
+        completion([[SealdMockServerResponse alloc] initWithStatus:status headers:@{@"Content-Type": @"application/json"} body:responseData ?: [NSData data]]);
+        return;
+    }
+    if (stubResponse != nil) {
+        completion(stubResponse);
+        return;
+    }
+
+    if (opts.trafficMode == SealdTrafficModeReplay) {
+        [self _replayRequest:request completion:completion];
+        return;
+    }
+    if (opts.upstreamUrl != nil) {
+        uint64_t start = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+        [self _forwardRequest:request toUpstream:opts.upstreamUrl completion:^(SealdMockServerResponse* response) {
+            if (opts.trafficMode == SealdTrafficModeRecord) {
+                [self _recordRequest:request response:response start:start end:clock_gettime_nsec_np(CLOCK_UPTIME_RAW)];
+            }
+            completion(response);
+        }];
+        return;
+    }
+    completion([SealdMockServerResponse jsonResponseWithStatus:404 code:@"MOCK_SERVER_NO_STUB" message:[NSString stringWithFormat:@"No stub for %@ %@", request.method, path]]);
+}
+
+- (void) _forwardRequest:(SealdMockServerRequest*)request
+              toUpstream:(NSString*)upstreamUrl
+              completion:(void (^)(SealdMockServerResponse* response))completion
+{
+    NSString* base = [upstreamUrl hasSuffix:@"/"] ? [upstreamUrl substringToIndex:[upstreamUrl length] - 1] : upstreamUrl;
+    NSURL* url = [NSURL URLWithString:[base stringByAppendingString:request.target]];
+    if (url == nil) {
+        completion([SealdMockServerResponse jsonResponseWithStatus:400 code:@"MOCK_SERVER_BAD_TARGET" message:request.target]);
+        return;
+    }
+    NSMutableURLRequest* upstreamRequest = [NSMutableURLRequest requestWithURL:url];
+    upstreamRequest.HTTPMethod = request.method;
+    for (NSString* name in request.headers) {
+        if (![hopByHopHeaders() containsObject:name]) {
+            [upstreamRequest setValue:request.headers[name] forHTTPHeaderField:name];
+        }
+    }
+    if ([request.body length] > 0) {
+        upstreamRequest.HTTPBody = request.body;
+    }
+
+    NSURLSessionDataTask* task = [upstreamSession dataTaskWithRequest:upstreamRequest completionHandler:^(NSData* data, NSURLResponse* urlResponse, NSError* err) {
+        if (err != nil || ![urlResponse isKindOfClass:[NSHTTPURLResponse class]]) {
+            completion([SealdMockServerResponse jsonResponseWithStatus:502 code:@"MOCK_SERVER_UPSTREAM_ERROR" message:err.localizedDescription ?: @"Invalid upstream response"]);
+            return;
+        }
+        NSHTTPURLResponse* httpResponse = (NSHTTPURLResponse*)urlResponse;
+        NSMutableDictionary<NSString*, NSString*>* headers = [NSMutableDictionary dictionary];
+        for (NSString* name in httpResponse.allHeaderFields) {
+            if (![hopByHopHeaders() containsObject:[name lowercaseString]]) {
+                headers[name] = httpResponse.allHeaderFields[name];
+            }
+        }
+        completion([[SealdMockServerResponse alloc] initWithStatus:httpResponse.statusCode headers:headers body:data ?: [NSData data]]);
+    }];
+    [task resume];
+}
+
+#pragma mark - Stand-in handlers
+
+// Returns the IDs of a list of members, given either as IDs or as objects with an `id`.
+static NSArray<NSString*>* memberIds(id members)
+{
+    NSMutableArray<NSString*>* res = [NSMutableArray array];
+    if (![members isKindOfClass:[NSArray class]]) {
+        return res;
+    }
+    for (id member in members) {
+        if ([member isKindOfClass:[NSString class]]) {
+            [res addObject:member];
+        } else if ([member isKindOfClass:[NSDictionary class]] && [member[@"id"] isKindOfClass:[NSString class]]) {
+            [res addObject:member[@"id"]];
+        }
+    }
+    return res;
+}
+
+- (void) installStandInHandlers
+{
+    // Session ID -> device ID -> key.
+    NSMutableDictionary<NSString*, NSMutableDictionary<NSString*, NSString*>*>* sessionKeys = [NSMutableDictionary dictionary];
+    // Group ID -> member IDs.
+    NSMutableDictionary<NSString*, NSMutableSet<NSString*>*>* groupMembers = [NSMutableDictionary dictionary];
+    // SSKS key -> stored data.
+    NSMutableDictionary<NSString*, NSString*>* ssksData = [NSMutableDictionary dictionary];
+
+    // Adds the keys of `encrypted_message_keys`, given as `{"created_for_key": device ID, "token": key}`, to a session.
+    void (^addKeys)(NSString*, id) = ^(NSString* sessionId, id keys) {
+        if (![keys isKindOfClass:[NSArray class]]) {
+            return;
+        }
+        for (NSDictionary* key in keys) {
+            if ([key isKindOfClass:[NSDictionary class]] && [key[@"created_for_key"] isKindOfClass:[NSString class]] && [key[@"token"] isKindOfClass:[NSString class]]) {
+                sessionKeys[sessionId][key[@"created_for_key"]] = key[@"token"];
+            }
+        }
+    };
+
+    [self stubMethod:@"POST" pathPattern:@"/api/message/" handler:^NSInteger (NSString* method, NSArray<NSString*>* params, NSDictionary<NSString*, NSString*>* query, id body, id* responseBody) {
+        NSString* sessionId = [[NSUUID UUID] UUIDString];
+        @synchronized (sessionKeys) {
+            sessionKeys[sessionId] = [NSMutableDictionary dictionary];
+            addKeys(sessionId, [body isKindOfClass:[NSDictionary class]] ? body[@"encrypted_message_keys"] : nil);
+        }
+        *responseBody = @{@"message": sessionId};
+        return 201;
+    }];
+    [self stubMethod:@"GET" pathPattern:@"/api/message/*/" handler:^NSInteger (NSString* method, NSArray<NSString*>* params, NSDictionary<NSString*, NSString*>* query, id body, id* responseBody) {
+        NSString* token = nil;
+        @synchronized (sessionKeys) {
+            token = sessionKeys[params[0]][query[@"created_for_key"] ?: @""];
+        }
+        if (token == nil) {
+            *responseBody = @{@"status": @404, @"code": @"MESSAGE_KEY_NOT_FOUND"};
+            return 404;
+        }
+        *responseBody = @{@"id": params[0], @"token": token};
+        return 200;
+    }];
+    [self stubMethod:@"POST" pathPattern:@"/api/message/*/add_key/" handler:^NSInteger (NSString* method, NSArray<NSString*>* params, NSDictionary<NSString*, NSString*>* query, id body, id* responseBody) {
+        @synchronized (sessionKeys) {
+            if (sessionKeys[params[0]] == nil) {
+                *responseBody = @{@"status": @404, @"code": @"MESSAGE_NOT_FOUND"};
+                return 404;
+            }
+            addKeys(params[0], [body isKindOfClass:[NSDictionary class]] ? body[@"encrypted_message_keys"] : nil);
+        }
+        *responseBody = @{};
+        return 200;
+    }];
+
+    [self stubMethod:@"GET" pathPattern:@"/api/group/*/members/" handler:^NSInteger (NSString* method, NSArray<NSString*>* params, NSDictionary<NSString*, NSString*>* query, id body, id* responseBody) {
+        @synchronized (groupMembers) {
+            *responseBody = @{@"results": [groupMembers[params[0]] allObjects] ?: @[]};
+        }
+        return 200;
+    }];
+    [self stubMethod:@"POST" pathPattern:@"/api/group/*/add_members/" handler:^NSInteger (NSString* method, NSArray<NSString*>* params, NSDictionary<NSString*, NSString*>* query, id body, id* responseBody) {
+        NSMutableDictionary<NSString*, NSString*>* status = [NSMutableDictionary dictionary];
+        @synchronized (groupMembers) {
+            if (groupMembers[params[0]] == nil) {
+                groupMembers[params[0]] = [NSMutableSet set];
+            }
+            for (NSString* memberId in memberIds([body isKindOfClass:[NSDictionary class]] ? body[@"members"] : nil)) {
+                status[memberId] = [groupMembers[params[0]] containsObject:memberId] ? @"already_member" : @"ok";
+                [groupMembers[params[0]] addObject:memberId];
+            }
+        }
+        *responseBody = @{@"status": status};
+        return 200;
+    }];
+    [self stubMethod:@"POST" pathPattern:@"/api/group/*/remove_members/" handler:^NSInteger (NSString* method, NSArray<NSString*>* params, NSDictionary<NSString*, NSString*>* query, id body, id* responseBody) {
+        NSMutableDictionary<NSString*, NSString*>* status = [NSMutableDictionary dictionary];
+        @synchronized (groupMembers) {
+            for (NSString* memberId in memberIds([body isKindOfClass:[NSDictionary class]] ? body[@"members"] : nil)) {
+                status[memberId] = [groupMembers[params[0]] containsObject:memberId] ? @"ok" : @"not_member";
+                [groupMembers[params[0]] removeObject:memberId];
+            }
+        }
+        *responseBody = @{@"status": status};
+        return 200;
+    }];
+
+    [self stubMethod:@"GET" pathPattern:@"/api/device/*/missing_message_keys/" handler:^NSInteger (NSString* method, NSArray<NSString*>* params, NSDictionary<NSString*, NSString*>* query, id body, id* responseBody) {
+        NSMutableArray<NSDictionary*>* missing = [NSMutableArray array];
+        @synchronized (sessionKeys) {
+            for (NSString* sessionId in sessionKeys) {
+                if (sessionKeys[sessionId][params[0]] == nil) {
+                    [missing addObject:@{@"message": sessionId}];
+                }
+            }
+        }
+        *responseBody = @{@"results": missing};
+        return 200;
+    }];
+    [self stubMethod:@"POST" pathPattern:@"/api/device/*/add_message_keys/" handler:^NSInteger (NSString* method, NSArray<NSString*>* params, NSDictionary<NSString*, NSString*>* query, id body, id* responseBody) {
+        id keys = [body isKindOfClass:[NSDictionary class]] ? body[@"message_keys"] : nil;
+        NSInteger added = 0;
+        @synchronized (sessionKeys) {
+            for (NSDictionary* key in [keys isKindOfClass:[NSArray class]] ? keys : @[]) {
+                if ([key isKindOfClass:[NSDictionary class]] && [key[@"message"] isKindOfClass:[NSString class]] && [key[@"token"] isKindOfClass:[NSString class]]
+                    && sessionKeys[key[@"message"]] != nil) {
+                    sessionKeys[key[@"message"]][params[0]] = key[@"token"];
+                    added++;
+                }
+            }
+        }
+        *responseBody = @{@"added": @(added)};
+        return 200;
+    }];
+
+    // SSKS entries are stored under the app, the user and the secret (password plugin) or the auth factor (TMR plugin).
+    NSString* (^ssksKey)(id, BOOL) = ^NSString* (id body, BOOL tmr) {
+        if (![body isKindOfClass:[NSDictionary class]]) {
+            return nil;
+        }
+        id factor = tmr ? body[@"auth_factor"] : body[@"secret"];
+        if ([factor isKindOfClass:[NSDictionary class]]) {
+            factor = [NSString stringWithFormat:@"%@:%@", factor[@"type"], factor[@"value"]];
+        }
+        return [NSString stringWithFormat:@"%@|%@|%@|%@", tmr ? @"tmr" : @"strict", body[@"app_id"], body[@"user_id"], factor];
+    };
+    SealdMockServerHandler (^ssksPush)(BOOL) = ^SealdMockServerHandler (BOOL tmr) {
+        return ^NSInteger (NSString* method, NSArray<NSString*>* params, NSDictionary<NSString*, NSString*>* query, id body, id* responseBody) {
+            NSString* key = ssksKey(body, tmr);
+            if (key == nil || ![body[@"data_b64"] isKindOfClass:[NSString class]]) {
+                *responseBody = @{@"status": @400, @"code": @"INVALID_BODY"};
+                return 400;
+            }
+            @synchronized (ssksData) {
+                ssksData[key] = body[@"data_b64"];
+            }
+            *responseBody = @{};
+            return 200;
+        };
+    };
+    SealdMockServerHandler (^ssksSearch)(BOOL) = ^SealdMockServerHandler (BOOL tmr) {
+        return ^NSInteger (NSString* method, NSArray<NSString*>* params, NSDictionary<NSString*, NSString*>* query, id body, id* responseBody) {
+            NSString* key = ssksKey(body, tmr);
+            NSString* data = nil;
+            @synchronized (ssksData) {
+                data = key != nil ? ssksData[key] : nil;
+            }
+            if (data == nil) {
+                *responseBody = @{@"status": @404, @"code": @"NOT_FOUND"};
+                return 404;
+            }
+            *responseBody = @{@"data_b64": data};
+            return 200;
+        };
+    };
+    [self stubMethod:@"POST" pathPattern:@"/strict/push" handler:ssksPush(NO)];
+    [self stubMethod:@"POST" pathPattern:@"/strict/search" handler:ssksSearch(NO)];
+    [self stubMethod:@"POST" pathPattern:@"/tmr/back/key/" handler:ssksPush(YES)];
+    [self stubMethod:@"POST" pathPattern:@"/tmr/front/search/" handler:ssksSearch(YES)];
+}
+
+#pragma mark - Record and replay
+
+- (BOOL) _openTrafficFileWithError:(NSError*_Nullable*)error
+{
+    SealdTrafficMode mode = self.options.trafficMode;
+    NSString* path = self.options.trafficFilePath;
+    if (mode == SealdTrafficModeNone) {
+        return YES;
+    }
+    if (path == nil) {
+        _SealdInternal_SetError(@"MOCK_SERVER_NO_TRAFFIC_FILE", @"trafficFilePath is required to record or replay traffic", error);
+        return NO;
+    }
+    if (mode == SealdTrafficModeRecord) {
+        if (![[NSFileManager defaultManager] fileExistsAtPath:path]) {
+            [[NSFileManager defaultManager] createFileAtPath:path contents:nil attributes:@{NSFileProtectionKey: NSFileProtectionCompleteUntilFirstUserAuthentication}];
+        }
+        trafficFileHandle = [NSFileHandle fileHandleForWritingAtPath:path];
+        if (trafficFileHandle == nil) {
+            _SealdInternal_SetError(@"MOCK_SERVER_TRAFFIC_FILE", [NSString stringWithFormat:@"Cannot open %@ for writing", path], error);
+            return NO;
+        }
+        [trafficFileHandle seekToEndOfFile];
+        trafficStartTime = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+        return YES;
+    }
+
+    NSError* localErr = nil;
+    NSString* contents = [NSString stringWithContentsOfFile:path encoding:NSUTF8StringEncoding error:&localErr];
+    if (localErr) {
+        if (error) *error = localErr;
+        return NO;
+    }
+    replayEntries = [NSMutableDictionary dictionary];
+    trafficStartTime = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+    for (NSString* line in [contents componentsSeparatedByString:@"\n"]) {
+        if ([line length] == 0) {
+            continue;
+        }
+        NSDictionary* entry = [NSJSONSerialization JSONObjectWithData:[line dataUsingEncoding:NSUTF8StringEncoding] options:0 error:nil];
+        if (![entry isKindOfClass:[NSDictionary class]]) {
+            continue;
+        }
+        NSString* key = [NSString stringWithFormat:@"%@ %@", entry[@"method"], entry[@"path"]];
+        if (replayEntries[key] == nil) {
+            replayEntries[key] = [NSMutableArray array];
+        }
+        [replayEntries[key] addObject:entry];
+    }
+    return YES;
+}
+
+- (void) _recordRequest:(SealdMockServerRequest*)request
+               response:(SealdMockServerResponse*)response
+                  start:(uint64_t)start
+                    end:(uint64_t)end
+{
+    NSDictionary* entry = @{
+        @"method": request.method,
+        @"path": [[request.target componentsSeparatedByString:@"?"] firstObject],
+        @"target": request.target,
+        @"offset": @((double)(start - trafficStartTime) / 1e9),
+        @"duration": @((double)(end - start) / 1e9),
+        @"requestHeaders": request.headers,
+        @"requestBody": [request.body base64EncodedStringWithOptions:0] ?: @"",
+        @"status": @(response.status),
+        @"responseHeaders": response.headers,
+        @"responseBody": [response.body base64EncodedStringWithOptions:0]
+    };
+    NSMutableData* line = [[NSJSONSerialization dataWithJSONObject:entry options:0 error:nil] mutableCopy];
+    [line appendBytes:"\n" length:1];
+    @synchronized (self) {
+        [trafficFileHandle writeData:line];
+    }
+}
+
+// Recorded exchanges are served in their recorded order for each method and path. Once they are exhausted, the last one is repeated.
+// A response is not sent before its recorded offset from the start of the session plus its recorded duration, so replaying does not run faster than the recording.
+- (void) _replayRequest:(SealdMockServerRequest*)request
+             completion:(void (^)(SealdMockServerResponse* response))completion
+{
+    NSString* key = [NSString stringWithFormat:@"%@ %@", request.method, [[request.target componentsSeparatedByString:@"?"] firstObject]];
+    NSDictionary* entry = nil;
+    @synchronized (self) {
+        NSMutableArray<NSDictionary*>* entries = replayEntries[key];
+        if ([entries count] > 1) {
+            entry = entries[0];
+            [entries removeObjectAtIndex:0];
+        } else {
+            entry = [entries firstObject];
+        }
+    }
+    if (entry == nil) {
+        completion([SealdMockServerResponse jsonResponseWithStatus:404 code:@"MOCK_SERVER_NOT_RECORDED" message:[NSString stringWithFormat:@"No recorded exchange for %@", key]]);
+        return;
+    }
+    NSData* body = [[NSData alloc] initWithBase64EncodedString:entry[@"responseBody"] options:0] ?: [NSData data];
+    SealdMockServerResponse* response = [[SealdMockServerResponse alloc] initWithStatus:[entry[@"status"] integerValue] headers:entry[@"responseHeaders"] ?: @{} body:body];
+    NSTimeInterval elapsed = (double)(clock_gettime_nsec_np(CLOCK_UPTIME_RAW) - trafficStartTime) / 1e9;
+    NSTimeInterval delay = MAX([entry[@"offset"] doubleValue] - elapsed, 0) + MAX([entry[@"duration"] doubleValue], 0);
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+        completion(response);
+    });
+}
+
++ (BOOL) exportRedactedTrafficFile:(const NSString*)path
+                            toPath:(const NSString*)redactedPath
+                             error:(NSError*_Nullable*)error
+{
+    NSError* localErr = nil;
+    NSString* contents = [NSString stringWithContentsOfFile:(NSString*)path encoding:NSUTF8StringEncoding error:&localErr];
+    if (localErr) {
+        if (error) *error = localErr;
+        return NO;
+    }
+    NSMutableString* res = [NSMutableString string];
+    for (NSString* line in [contents componentsSeparatedByString:@"\n"]) {
+        if ([line length] == 0) {
+            continue;
+        }
+        NSMutableDictionary* entry = [[NSJSONSerialization JSONObjectWithData:[line dataUsingEncoding:NSUTF8StringEncoding] options:NSJSONReadingMutableContainers error:nil] mutableCopy];
+        if (![entry isKindOfClass:[NSDictionary class]]) {
+            continue;
+        }
+        entry[@"requestHeaders"] = redactedHeaders(entry[@"requestHeaders"] ?: @{});
+        entry[@"requestBody"] = redactedBody(entry[@"requestBody"]);
+        entry[@"responseHeaders"] = redactedHeaders(entry[@"responseHeaders"] ?: @{});
+        entry[@"responseBody"] = redactedBody(entry[@"responseBody"]);
+        NSData* redactedLine = [NSJSONSerialization dataWithJSONObject:entry options:0 error:nil];
+        [res appendString:[[NSString alloc] initWithData:redactedLine encoding:NSUTF8StringEncoding]];
+        [res appendString:@"\n"];
+    }
+    return [res writeToFile:(NSString*)redactedPath atomically:YES encoding:NSUTF8StringEncoding error:error];
+}
+@end
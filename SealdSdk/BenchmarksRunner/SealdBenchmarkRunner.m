@@ -0,0 +1,52 @@
+//
+//  SealdBenchmarkRunner.m
+//  SealdSdkBenchmarksRunner
+//
+//  Created by Seald SAS on 18/10/2026.
+//  Copyright © 2026 Seald SAS. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+@import SealdSdkBenchmarks;
+
+// Runs SealdBenchmark and writes its results. As SealdSdkInternals is only built for iOS, this runs on a device or a simulator:
+//   TEST_RUNNER_SEALD_BENCHMARK_API_URL=... TEST_RUNNER_SEALD_BENCHMARK_APP_ID=... \
+//   xcodebuild test -scheme SealdSdk-Package -destination 'platform=iOS Simulator,name=iPhone 15'
+// The `TEST_RUNNER_` prefix is removed by xcodebuild. Other variables:
+// - SEALD_BENCHMARK_SIGNUP_JWT: a signup JWT, to run the benchmarks that need an account.
+// - SEALD_BENCHMARK_ITERATIONS: overrides SealdBenchmarkOptions.iterations.
+// - SEALD_BENCHMARK_OUTPUT_PATH: where to write the JSON results. Defaults to `seald-benchmark.json` in the temporary directory.
+// The results are also attached to the test report.
+@interface SealdBenchmarkRunner : XCTestCase
+@end
+
+@implementation SealdBenchmarkRunner
+- (void) testRunBenchmarks
+{
+    NSDictionary<NSString*, NSString*>* env = [[NSProcessInfo processInfo] environment];
+    NSString* apiUrl = env[@"SEALD_BENCHMARK_API_URL"];
+    NSString* appId = env[@"SEALD_BENCHMARK_APP_ID"];
+    if (apiUrl == nil || appId == nil) {
+        XCTSkip(@"SEALD_BENCHMARK_API_URL and SEALD_BENCHMARK_APP_ID are not set");
+    }
+
+    SealdBenchmarkOptions* options = [[SealdBenchmarkOptions alloc] initWithApiUrl:apiUrl appId:appId];
+    options.signupJwt = env[@"SEALD_BENCHMARK_SIGNUP_JWT"];
+    if (env[@"SEALD_BENCHMARK_ITERATIONS"] != nil) {
+        options.iterations = [env[@"SEALD_BENCHMARK_ITERATIONS"] integerValue];
+    }
+    options.outputPath = env[@"SEALD_BENCHMARK_OUTPUT_PATH"] ?: [NSTemporaryDirectory() stringByAppendingPathComponent:@"seald-benchmark.json"];
+
+    NSError* error = nil;
+    NSArray<SealdBenchmarkResult*>* results = [[[SealdBenchmark alloc] initWithOptions:options] runWithError:&error];
+    XCTAssertNil(error);
+    if (results == nil) {
+        return;
+    }
+    XCTAssertGreaterThan([results count], 0);
+
+    XCTAttachment* attachment = [XCTAttachment attachmentWithContentsOfFileAtURL:[NSURL fileURLWithPath:options.outputPath]];
+    attachment.lifetime = XCTAttachmentLifetimeKeepAlways;
+    [self addAttachment:attachment];
+}
+@end
@@ -42,6 +42,8 @@ typedef SealdSdkInternalsMobile_sdkPreGeneratedKeys SealdGeneratedPrivateKeys;
 /** \cond */
 void _SealdInternal_ConvertError(NSError* originalError, NSError*_Nullable* errorPtr);
 
+void _SealdInternal_SetError(NSString* code, NSString* description, NSError*_Nullable* errorPtr);
+
 SealdSdkInternalsMobile_sdkStringArray* arrayToStringArray(const NSArray<NSString*>* stringArray);
 
 NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* stringArray);
@@ -214,6 +216,11 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
 @property (atomic, assign) NSInteger waitProvisioningRetries;
 /** Whether to update the local account before trying the reencryption. Defaults to `NO`. */
 @property (atomic, assign) BOOL forceLocalAccountUpdate;
+/**
+ * Maximum number of devices re-encrypted at the same time by SealdSdk.massReencryptWithDeviceIds:options:. Defaults to 4.
+ * Only that multi-device function uses it: the keys of a single device are re-encrypted by one native call, which has no concurrency setting.
+ */
+@property (atomic, assign) NSInteger concurrency;
 /**
  * Initialize a SealdMassReencryptOptions instance with default values.
  */
@@ -223,6 +230,51 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
 /** \endcond */
 @end
 
+/**
+ * A callback reporting the progress of an operation on many items. Called after each item, with the number of items done so far and the total number of items.
+ */
+typedef void (^SealdBulkProgressHandler)(NSInteger done, NSInteger total);
+
+/**
+ * SealdBulkOptions represents options for functions operating on many encryption sessions at once,
+ * like SealdSdk.addRecipients:toSessionIds:options:progress:.
+ */
+@interface SealdBulkOptions : NSObject
+/** Number of sessions retrieved per API call. Defaults to 100. */
+@property (atomic, assign) NSInteger batchSize;
+/** Maximum number of sessions being processed at the same time. Defaults to 8. */
+@property (atomic, assign) NSInteger maxConcurrency;
+/** Whether to try retrieving sessions via a proxy. Defaults to `NO`. */
+@property (atomic, assign) BOOL lookupProxyKey;
+/** Whether to try retrieving sessions via a group. Defaults to `YES`. */
+@property (atomic, assign) BOOL lookupGroupKey;
+/** Whether sessions may be taken from the caches, instead of being retrieved from the server. Defaults to `NO`. */
+@property (atomic, assign) BOOL useCache;
+/**
+ * Initialize a SealdBulkOptions instance with default values.
+ */
+- (instancetype) init;
+@end
+
+/**
+ * SealdGroupMembersOptions represents options for functions adding or removing many group members at once,
+ * like SealdSdk.addGroupMembersWithGroupId:membersToAdd:adminsToSet:privateKeys:options:progress:error:.
+ */
+@interface SealdGroupMembersOptions : NSObject
+/** Number of members sent per API call. Defaults to 200. */
+@property (atomic, assign) NSInteger chunkSize;
+/** Maximum number of chunks being sent at the same time. Defaults to 4. */
+@property (atomic, assign) NSInteger maxConcurrency;
+/** Number of times a chunk that failed with a network or server error is retried. Defaults to 2. */
+@property (atomic, assign) NSInteger retries;
+/** Delay before the first retry of a chunk, multiplied by the attempt number for later retries. Defaults to 1 second. */
+@property (atomic, assign) NSTimeInterval retryDelay;
+/**
+ * Initialize a SealdGroupMembersOptions instance with default values.
+ */
+- (instancetype) init;
+@end
+
 /**
  * SealdMassReencryptResponse represents the results of a call to SealdSdk.massReencryptWithDeviceId:options:error:.
  */
@@ -238,6 +290,50 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
 /** \endcond */
 @end
 
+/** \cond */
+// Lets the SDK cancel a long-running internal operation, like the warm-up of the session cache.
+// Cancellation is cooperative: the operation stops at its next checkpoint.
+@interface SealdCancellationToken : NSObject
+@property (atomic, assign, readonly) BOOL isCancelled;
+- (void) cancel;
+@end
+/** \endcond */
+
+/**
+ * SealdKeyProvisioningOptions represents options for SealdSdk.startKeyProvisioningWithOptions:onDeviceProvisioned:onPassError:error:.
+ */
+@interface SealdKeyProvisioningOptions : NSObject
+/** Time between two checks for devices missing keys. Must be greater than `0`. Defaults to 5 minutes. */
+@property (atomic, assign) NSTimeInterval pollInterval;
+/** Maximum delay a device waits before taking over a device missing keys. Each device waits a different delay, derived from its own ID and the ID of the device to provision, plus some jitter, then checks again whether keys are still missing. Defaults to 30 seconds. */
+@property (atomic, assign) NSTimeInterval maxStagger;
+/** Minimum time between the end of a re-encryption and the start of the next one, to limit the load on this device and on the server. Defaults to 10 seconds. */
+@property (atomic, assign) NSTimeInterval minTimeBetweenReencryptions;
+/** The options passed to SealdSdk.massReencryptWithDeviceId:options:error:. Defaults to default options, with a `retrieveBatchSize` of 100 to keep each request small. */
+@property (atomic, strong) SealdMassReencryptOptions* reencryptOptions;
+/**
+ * Initialize a SealdKeyProvisioningOptions instance with default values.
+ */
+- (instancetype) init;
+@end
+
+/**
+ * SealdCacheInvalidationOptions represents options for SealdSdk.pollCacheInvalidationsWithOptions: and SealdSdk.startCacheInvalidationPollWithOptions:onPass:error:.
+ */
+@interface SealdCacheInvalidationOptions : NSObject
+/** Time between two polls, for SealdSdk.startCacheInvalidationPollWithOptions:onPass:error:. Must be greater than `0`. Defaults to 5 minutes. */
+@property (atomic, assign) NSTimeInterval pollInterval;
+/**
+ * Number of cached or stored sessions, created or retrieved directly, via a group or via a proxy, that are checked against the server on each poll, least recently checked first,
+ * in one batched request. `0` to only check groups. Defaults to 20.
+ */
+@property (atomic, assign) NSInteger revalidationBatchSize;
+/**
+ * Initialize a SealdCacheInvalidationOptions instance with default values.
+ */
+- (instancetype) init;
+@end
+
 /**
  * SealdDeviceMissingKeys represents a device of the current account which is missing some keys,
  * and for which you probably want to call SealdSdk.massReencryptWithDeviceId:options:error:.
@@ -265,6 +361,12 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
 @property (atomic, strong) NSString* result;
 /** \cond */
 + (NSDictionary<NSString*,SealdActionStatus*>*) fromMobileSdkArray:(SealdSdkInternalsMobile_sdkActionStatusArray*)array;
++ (instancetype) statusWithSuccess:(bool)success
+                         errorCode:(NSString*)errorCode
+                            result:(NSString*)result;
++ (instancetype) statusWithError:(NSError*)error;
+- (NSDictionary<NSString*, id>*) toDictionary;
++ (instancetype) fromDictionary:(NSDictionary<NSString*, id>*)dictionary;
 /** \endcond */
 @end
 
@@ -280,6 +382,89 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
 - (instancetype) initWithRecipients:(NSDictionary<NSString*,SealdActionStatus*>*)recipients
                       proxySessions:(NSDictionary<NSString*,SealdActionStatus*>*)proxySessions;
 + (instancetype) fromMobileSdk:(SealdSdkInternalsMobile_sdkRevokeResult*)revokeResult;
+- (NSDictionary<NSString*, id>*) toDictionary;
++ (instancetype) fromDictionary:(NSDictionary<NSString*, id>*)dictionary;
+/** \endcond */
+@end
+
+/**
+ * SealdSetRecipientsResult represents the changes made by SealdEncryptionSession.setRecipients:rights:error:.
+ */
+@interface SealdSetRecipientsResult : NSObject
+/** The status of each recipient that was added. Empty if no recipient was missing. */
+@property (atomic, strong, readonly) NSDictionary<NSString*, SealdActionStatus*>* added;
+/** The result of the revocation of extra recipients and of recipients whose rights changed, or `nil` if there was no recipient to revoke or if the revocation failed. */
+@property (atomic, strong, readonly, nullable) SealdRevokeResult* revoked;
+/** For each recipient whose rights changed, the status of adding it again with the new rights, or the failed status of its revocation. */
+@property (atomic, strong, readonly) NSDictionary<NSString*, SealdActionStatus*>* rightsChanged;
+/** The error that interrupted the operation after some changes were applied, or `nil` if all steps ran. The other properties describe the changes applied before it. */
+@property (atomic, strong, readonly, nullable) NSError* error;
+/** \cond */
+- (instancetype) initWithAdded:(NSDictionary<NSString*, SealdActionStatus*>*)added
+                       revoked:(SealdRevokeResult*_Nullable)revoked
+                 rightsChanged:(NSDictionary<NSString*, SealdActionStatus*>*)rightsChanged
+                         error:(NSError*_Nullable)error;
+/** \endcond */
+@end
+
+/**
+ * SealdBulkRevokeResult represents the result of a revocation operation on many sessions.
+ */
+@interface SealdBulkRevokeResult : NSObject
+/** For each session on which the revocation was done, its result. */
+@property (atomic, strong, readonly) NSDictionary<NSString*, SealdRevokeResult*>* revokeResults;
+/** For each session on which the revocation could not be done, a failed SealdActionStatus describing why. */
+@property (atomic, strong, readonly) NSDictionary<NSString*, SealdActionStatus*>* failedSessions;
+/** \cond */
+- (instancetype) initWithRevokeResults:(NSDictionary<NSString*, SealdRevokeResult*>*)revokeResults
+                        failedSessions:(NSDictionary<NSString*, SealdActionStatus*>*)failedSessions;
+/** \endcond */
+@end
+
+/**
+ * SealdGroupKeyRenewalReport represents the result of checking, and possibly renewing, the keys of many groups.
+ */
+@interface SealdGroupKeyRenewalReport : NSObject
+/** The groups whose key should be renewed. */
+@property (atomic, strong, readonly) NSArray<NSString*>* needingRenewal;
+/** The groups whose key was renewed. Always empty for a check only. */
+@property (atomic, strong, readonly) NSArray<NSString*>* renewed;
+/** For each group that could not be checked or renewed, a failed SealdActionStatus. */
+@property (atomic, strong, readonly) NSDictionary<NSString*, SealdActionStatus*>* failed;
+/** \cond */
+- (instancetype) initWithNeedingRenewal:(NSArray<NSString*>*)needingRenewal
+                                renewed:(NSArray<NSString*>*)renewed
+                                 failed:(NSDictionary<NSString*, SealdActionStatus*>*)failed;
+/** \endcond */
+@end
+
+/**
+ * SealdBulkTmrAccessesResult represents the result of adding TMR accesses to many sessions.
+ */
+@interface SealdBulkTmrAccessesResult : NSObject
+/** For each session, a SealdActionStatus that succeeded if all TMR accesses were added. */
+@property (atomic, strong, readonly) NSDictionary<NSString*, SealdActionStatus*>* sessions;
+/** For each session on which the operation was done, the status of each TMR access, as returned by SealdEncryptionSession.addMultipleTmrAccesses:error:. */
+@property (atomic, strong, readonly) NSDictionary<NSString*, NSDictionary<NSString*, SealdActionStatus*>*>* recipients;
+/** \cond */
+- (instancetype) initWithSessions:(NSDictionary<NSString*, SealdActionStatus*>*)sessions
+                       recipients:(NSDictionary<NSString*, NSDictionary<NSString*, SealdActionStatus*>*>*)recipients;
+/** \endcond */
+@end
+
+/**
+ * SealdMassReencryptDevicesResult represents the results of a call to SealdSdk.massReencryptWithDeviceIds:options:.
+ */
+@interface SealdMassReencryptDevicesResult : NSObject
+/** For each device for which re-encryption ran, its SealdMassReencryptResponse. */
+@property (atomic, strong, readonly) NSDictionary<NSString*, SealdMassReencryptResponse*>* responses;
+/** For each device for which re-encryption could not run, a failed SealdActionStatus. */
+@property (atomic, strong, readonly) NSDictionary<NSString*, SealdActionStatus*>* errors;
+/** The total number of session keys that were reencrypted, over all devices. */
+@property (atomic, assign, readonly) NSInteger reencrypted;
+/** \cond */
+- (instancetype) initWithResponses:(NSDictionary<NSString*, SealdMassReencryptResponse*>*)responses
+                            errors:(NSDictionary<NSString*, SealdActionStatus*>*)errors;
 /** \endcond */
 @end
 
@@ -382,6 +567,95 @@ typedef NS_ENUM (NSInteger, SealdEncryptionSessionRetrievalFlow) {
 /** \endcond */
 @end
 
+/**
+ * SealdCacheFlowStats represents the retrieval counters of one retrieval flow, as returned in SealdCacheStats.
+ */
+@interface SealdCacheFlowStats : NSObject
+/** The number of retrievals answered by the memory cache of the SDK instance. */
+@property (atomic, assign, readonly) NSInteger memoryHits;
+/** The number of retrievals answered by the session store. */
+@property (atomic, assign, readonly) NSInteger storeHits;
+/** The number of retrievals answered by the cache of the native core, as reported by SealdEncryptionSessionRetrievalDetails.fromCache. */
+@property (atomic, assign, readonly) NSInteger nativeCacheHits;
+/** The number of retrievals that contacted the server. */
+@property (atomic, assign, readonly) NSInteger misses;
+/** The share of retrievals answered without contacting the server, between `0` and `1`. `0` if there was no retrieval. */
+@property (atomic, assign, readonly) double hitRate;
+/** \cond */
+- (instancetype) initWithMemoryHits:(NSInteger)memoryHits
+                          storeHits:(NSInteger)storeHits
+                    nativeCacheHits:(NSInteger)nativeCacheHits
+                             misses:(NSInteger)misses;
+/** \endcond */
+@end
+
+/**
+ * SealdCacheStats is a snapshot of the encryption session caches of a SealdSdk instance, returned by SealdSdk.getCacheStats.
+ * Counters are counted since the instance was initialized, or since the last call to SealdSdk.resetCacheStats.
+ */
+@interface SealdCacheStats : NSObject
+/** Retrievals of sessions of which the user is a direct recipient. */
+@property (atomic, strong, readonly) SealdCacheFlowStats* direct;
+/** Retrievals of sessions through a group. */
+@property (atomic, strong, readonly) SealdCacheFlowStats* viaGroup;
+/** Retrievals of sessions through a proxy session. */
+@property (atomic, strong, readonly) SealdCacheFlowStats* viaProxy;
+/** Retrievals of sessions through a SymEncKey. */
+@property (atomic, strong, readonly) SealdCacheFlowStats* viaSymEncKey;
+/** Retrievals of sessions through a TMR access. */
+@property (atomic, strong, readonly) SealdCacheFlowStats* viaTmrAccess;
+/** All retrievals, whatever their flow. */
+@property (atomic, strong, readonly) SealdCacheFlowStats* total;
+/** The number of sessions in the memory cache, pinned or not. */
+@property (atomic, assign, readonly) NSInteger memoryEntries;
+/** The number of pinned sessions in the memory cache. */
+@property (atomic, assign, readonly) NSInteger pinnedEntries;
+/** The number of sessions in the session store. */
+@property (atomic, assign, readonly) NSInteger storeEntries;
+/** The size on disk of the session store, in bytes. */
+@property (atomic, assign, readonly) NSInteger storeSize;
+/** The number of sessions removed from the memory cache because their TTL expired. */
+@property (atomic, assign, readonly) NSInteger expiredEvictions;
+/** The number of sessions removed from the memory cache to stay within SealdSdkOptions.sessionCacheMaxEntries. */
+@property (atomic, assign, readonly) NSInteger capacityEvictions;
+/** The number of sessions removed from the memory cache because they were revoked or cleared. */
+@property (atomic, assign, readonly) NSInteger invalidations;
+/** The number of sessions removed from the session store to stay within SealdSdkOptions.sessionStoreMaxEntries. */
+@property (atomic, assign, readonly) NSInteger storeEvictions;
+/** \cond */
+- (instancetype) initWithFlows:(NSDictionary<NSNumber*, SealdCacheFlowStats*>*)flows
+                         total:(SealdCacheFlowStats*)total
+                 memoryEntries:(NSInteger)memoryEntries
+                 pinnedEntries:(NSInteger)pinnedEntries
+                  storeEntries:(NSInteger)storeEntries
+                     storeSize:(NSInteger)storeSize
+              expiredEvictions:(NSInteger)expiredEvictions
+             capacityEvictions:(NSInteger)capacityEvictions
+                 invalidations:(NSInteger)invalidations
+                storeEvictions:(NSInteger)storeEvictions;
+/** \endcond */
+@end
+
+/**
+ * SealdCacheEntryInfo describes a session in the memory cache, as returned by SealdSdk.listCacheEntries.
+ */
+@interface SealdCacheEntryInfo : NSObject
+/** The ID of the session. */
+@property (atomic, strong, readonly) NSString* sessionId;
+/** How the session was originally retrieved. */
+@property (atomic, strong, readonly) SealdEncryptionSessionRetrievalDetails* retrievalDetails;
+/** Whether the session is pinned. */
+@property (atomic, assign, readonly) BOOL pinned;
+/** When the session expires from the memory cache. `nil` if it never expires. */
+@property (atomic, strong, readonly, nullable) NSDate* expiresAt;
+/** \cond */
+- (instancetype) initWithSessionId:(NSString*)sessionId
+                  retrievalDetails:(SealdEncryptionSessionRetrievalDetails*)retrievalDetails
+                            pinned:(BOOL)pinned
+                         expiresAt:(NSDate*_Nullable)expiresAt;
+/** \endcond */
+@end
+
 /**
  * SealdGetSigchainResponse is returned when calling SealdSdk.getSigchainHashWithUserId:position:error:
  * containing the hash value and the position of the hash in the sigchain.
@@ -741,6 +1015,75 @@ typedef NS_ENUM (NSInteger, SealdEncryptionSessionRetrievalFlow) {
 + (instancetype) fromMobileSdk:(SealdSdkInternalsMobile_sdkRecipientsList*)nativeList;
 @end
 
+/**
+ * SealdPagedRecipientsList holds all recipients from a session, converted to Objective-C objects only when they are accessed.
+ * The whole list is still fetched from the server, in one request, when it is created: only the conversion is lazy.
+ * Use it instead of SealdRecipientsList for sessions with many recipients, to convert them page by page.
+ */
+@interface SealdPagedRecipientsList : NSObject
+
+/** The number of Seald recipients of the session. */
+@property (nonatomic, assign, readonly) NSInteger sealdRecipientsCount;
+/** The number of TMR accesses of the session. */
+@property (nonatomic, assign, readonly) NSInteger tmrAccessesCount;
+/** The number of proxy sessions of the session. */
+@property (nonatomic, assign, readonly) NSInteger proxySessionsCount;
+/** The number of symmetric encryption keys of the session. */
+@property (nonatomic, assign, readonly) NSInteger symEncKeysCount;
+
+/**
+ * Get the Seald recipients in the given range. The range is clamped to `sealdRecipientsCount`.
+ *
+ * @param range The range of recipients to return.
+ * @return An array of `SealdSealdRecipient`.
+ */
+- (NSArray<SealdSealdRecipient*>*) sealdRecipientsInRange:(NSRange)range;
+
+/**
+ * Get the TMR accesses in the given range. The range is clamped to `tmrAccessesCount`.
+ *
+ * @param range The range of TMR accesses to return.
+ * @return An array of `SealdTmrAccess`.
+ */
+- (NSArray<SealdTmrAccess*>*) tmrAccessesInRange:(NSRange)range;
+
+/**
+ * Get the proxy sessions in the given range. The range is clamped to `proxySessionsCount`.
+ *
+ * @param range The range of proxy sessions to return.
+ * @return An array of `SealdProxySession`.
+ */
+- (NSArray<SealdProxySession*>*) proxySessionsInRange:(NSRange)range;
+
+/**
+ * Get the symmetric encryption keys in the given range. The range is clamped to `symEncKeysCount`.
+ *
+ * @param range The range of symmetric encryption keys to return.
+ * @return An array of `SealdSymEncKey`.
+ */
+- (NSArray<SealdSymEncKey*>*) symEncKeysInRange:(NSRange)range;
+
+/**
+ * Iterate over the Seald recipients, page by page. Only the current page is converted and held in memory.
+ *
+ * @param pageSize The number of recipients per page. Values lower than `1` are treated as `1`.
+ * @param block A callback called for each page. Set `stop` to `YES` to stop iterating.
+ */
+- (void) enumerateSealdRecipientsWithPageSize:(NSInteger)pageSize
+                                   usingBlock:(void (^)(NSArray<SealdSealdRecipient*>* page, BOOL* stop))block;
+
+/**
+ * Convert all recipients at once.
+ *
+ * @return A SealdRecipientsList instance.
+ */
+- (SealdRecipientsList*) toRecipientsList;
+
+/** \cond */
+- (instancetype) initWithMobileSdk:(SealdSdkInternalsMobile_sdkRecipientsList*)nativeList;
+/** \endcond */
+@end
+
 NS_ASSUME_NONNULL_END
 
 #endif /* SealdHelpers_h */
@@ -67,6 +67,26 @@ void _SealdInternal_ConvertError(NSError* originalError, NSError*_Nullable* erro
     *errorPtr = [NSError errorWithDomain:SealdErrorDomain code:SealdErrorCodeSealdError userInfo:userInfo];
 }
 
+// Errors raised by the Objective-C layer itself, with the same userInfo shape as errors from the native core.
+void _SealdInternal_SetError(NSString* code, NSString* description, NSError*_Nullable* errorPtr) {
+    if (errorPtr == nil) { // no pointer, nowhere to store, error ignored
+        return;
+    }
+    NSString* customDescription = [NSString stringWithFormat:@"SealdException(status=(null), code='%@', id='%@', description='%@', details='(null)', raw='(null)', nativeStack='(null)')",
+                                   code, code, description];
+    NSDictionary* userInfo = @{
+        @"status": [NSNull null],
+        @"code": code,
+        @"id": code,
+        @"description": description,
+        @"details": [NSNull null],
+        @"raw": [NSNull null],
+        @"nativeStack": [NSNull null],
+        NSLocalizedDescriptionKey: customDescription
+    };
+    *errorPtr = [NSError errorWithDomain:SealdErrorDomain code:SealdErrorCodeSealdError userInfo:userInfo];
+}
+
 SealdSdkInternalsMobile_sdkStringArray* arrayToStringArray(const NSArray<NSString*>* stringArray) {
     SealdSdkInternalsMobile_sdkStringArray* result = [[SealdSdkInternalsMobile_sdkStringArray alloc] init];
     for (NSString* string in stringArray) {
@@ -266,6 +286,7 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
         _waitProvisioningTimeStep = 1.0;
         _waitProvisioningRetries = 100;
         _forceLocalAccountUpdate = NO;
+        _concurrency = 4;
     }
     return self;
 }
@@ -285,6 +306,63 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
 }
 @end
 
+@implementation SealdBulkOptions
+- (instancetype) init
+{
+    self = [super init];
+    if (self) {
+        _batchSize = 100;
+        _maxConcurrency = 8;
+        _lookupProxyKey = NO;
+        _lookupGroupKey = YES;
+        _useCache = NO;
+    }
+    return self;
+}
+@end
+
+@implementation SealdGroupMembersOptions
+- (instancetype) init
+{
+    self = [super init];
+    if (self) {
+        _chunkSize = 200;
+        _maxConcurrency = 4;
+        _retries = 2;
+        _retryDelay = 1;
+    }
+    return self;
+}
+@end
+
+@implementation SealdGroupKeyRenewalReport
+- (instancetype) initWithNeedingRenewal:(NSArray<NSString*>*)needingRenewal
+                                renewed:(NSArray<NSString*>*)renewed
+                                 failed:(NSDictionary<NSString*, SealdActionStatus*>*)failed
+{
+    self = [super init];
+    if (self) {
+        _needingRenewal = needingRenewal;
+        _renewed = renewed;
+        _failed = failed;
+    }
+    return self;
+}
+@end
+
+@implementation SealdBulkTmrAccessesResult
+- (instancetype) initWithSessions:(NSDictionary<NSString*, SealdActionStatus*>*)sessions
+                       recipients:(NSDictionary<NSString*, NSDictionary<NSString*, SealdActionStatus*>*>*)recipients
+{
+    self = [super init];
+    if (self) {
+        _sessions = sessions;
+        _recipients = recipients;
+    }
+    return self;
+}
+@end
+
 @implementation SealdMassReencryptResponse
 - (instancetype) initWithReencrypted:(NSInteger)reencrypted
                               failed:(NSInteger)failed
@@ -302,6 +380,58 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
 }
 @end
 
+@implementation SealdMassReencryptDevicesResult
+- (instancetype) initWithResponses:(NSDictionary<NSString*, SealdMassReencryptResponse*>*)responses
+                            errors:(NSDictionary<NSString*, SealdActionStatus*>*)errors
+{
+    self = [super init];
+    if (self) {
+        _responses = responses;
+        _errors = errors;
+        NSInteger reencrypted = 0;
+        for (NSString* deviceId in responses) {
+            reencrypted += responses[deviceId].reencrypted;
+        }
+        _reencrypted = reencrypted;
+    }
+    return self;
+}
+@end
+
+@implementation SealdKeyProvisioningOptions
+- (instancetype) init
+{
+    self = [super init];
+    if (self) {
+        _pollInterval = 5 * 60;
+        _maxStagger = 30;
+        _minTimeBetweenReencryptions = 10;
+        _reencryptOptions = [[SealdMassReencryptOptions alloc] init];
+        _reencryptOptions.retrieveBatchSize = 100;
+    }
+    return self;
+}
+@end
+
+@implementation SealdCacheInvalidationOptions
+- (instancetype) init
+{
+    self = [super init];
+    if (self) {
+        _pollInterval = 5 * 60;
+        _revalidationBatchSize = 20;
+    }
+    return self;
+}
+@end
+
+@implementation SealdCancellationToken
+- (void) cancel
+{
+    _isCancelled = YES;
+}
+@end
+
 @implementation SealdDeviceMissingKeys
 - (instancetype) initWithDeviceId:(NSString*)deviceId
 {
@@ -340,6 +470,33 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
 
     return dictionary;
 }
++ (instancetype) statusWithSuccess:(bool)success
+                         errorCode:(NSString*)errorCode
+                            result:(NSString*)result
+{
+    SealdActionStatus* as = [[SealdActionStatus alloc] init];
+    as.success = success;
+    as.errorCode = errorCode;
+    as.result = result;
+    return as;
+}
++ (instancetype) statusWithError:(NSError*)error
+{
+    id code = error.userInfo[@"code"];
+    return [SealdActionStatus statusWithSuccess:false
+                                      errorCode:[code isKindOfClass:[NSString class]] ? code : @"UNKNOWN"
+                                         result:error.localizedDescription ?: @""];
+}
+- (NSDictionary<NSString*, id>*) toDictionary
+{
+    return @{@"success": @(self.success), @"errorCode": self.errorCode ?: @"", @"result": self.result ?: @""};
+}
++ (instancetype) fromDictionary:(NSDictionary<NSString*, id>*)dictionary
+{
+    return [SealdActionStatus statusWithSuccess:[dictionary[@"success"] boolValue]
+                                      errorCode:dictionary[@"errorCode"] ?: @""
+                                         result:dictionary[@"result"] ?: @""];
+}
 @end
 
 @implementation SealdRevokeResult
@@ -359,6 +516,61 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
     return [[SealdRevokeResult alloc] initWithRecipients:[SealdActionStatus fromMobileSdkArray:revokeResult.recipients]
                                            proxySessions:[SealdActionStatus fromMobileSdkArray:revokeResult.proxySessions]];
 }
+static NSDictionary<NSString*, id>* statusesToDictionary(NSDictionary<NSString*, SealdActionStatus*>* statuses)
+{
+    NSMutableDictionary<NSString*, id>* res = [NSMutableDictionary dictionaryWithCapacity:[statuses count]];
+    for (NSString* key in statuses) {
+        res[key] = [statuses[key] toDictionary];
+    }
+    return res;
+}
+static NSDictionary<NSString*, SealdActionStatus*>* statusesFromDictionary(NSDictionary<NSString*, id>* dictionary)
+{
+    NSMutableDictionary<NSString*, SealdActionStatus*>* res = [NSMutableDictionary dictionaryWithCapacity:[dictionary count]];
+    for (NSString* key in dictionary) {
+        res[key] = [SealdActionStatus fromDictionary:dictionary[key]];
+    }
+    return res;
+}
+- (NSDictionary<NSString*, id>*) toDictionary
+{
+    return @{@"recipients": statusesToDictionary(self.recipients), @"proxySessions": statusesToDictionary(self.proxySessions)};
+}
++ (instancetype) fromDictionary:(NSDictionary<NSString*, id>*)dictionary
+{
+    return [[SealdRevokeResult alloc] initWithRecipients:statusesFromDictionary(dictionary[@"recipients"])
+                                           proxySessions:statusesFromDictionary(dictionary[@"proxySessions"])];
+}
+@end
+
+@implementation SealdSetRecipientsResult
+- (instancetype) initWithAdded:(NSDictionary<NSString*, SealdActionStatus*>*)added
+                       revoked:(SealdRevokeResult*_Nullable)revoked
+                 rightsChanged:(NSDictionary<NSString*, SealdActionStatus*>*)rightsChanged
+                         error:(NSError*_Nullable)error
+{
+    self = [super init];
+    if (self) {
+        _added = added;
+        _revoked = revoked;
+        _rightsChanged = rightsChanged;
+        _error = error;
+    }
+    return self;
+}
+@end
+
+@implementation SealdBulkRevokeResult
+- (instancetype) initWithRevokeResults:(NSDictionary<NSString*, SealdRevokeResult*>*)revokeResults
+                        failedSessions:(NSDictionary<NSString*, SealdActionStatus*>*)failedSessions
+{
+    self = [super init];
+    if (self) {
+        _revokeResults = revokeResults;
+        _failedSessions = failedSessions;
+    }
+    return self;
+}
 @end
 
 @implementation SealdRecipientRights
@@ -460,6 +672,75 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
 }
 @end
 
+@implementation SealdCacheFlowStats
+- (instancetype) initWithMemoryHits:(NSInteger)memoryHits
+                          storeHits:(NSInteger)storeHits
+                    nativeCacheHits:(NSInteger)nativeCacheHits
+                             misses:(NSInteger)misses
+{
+    self = [super init];
+    if (self) {
+        _memoryHits = memoryHits;
+        _storeHits = storeHits;
+        _nativeCacheHits = nativeCacheHits;
+        _misses = misses;
+        NSInteger hits = memoryHits + storeHits + nativeCacheHits;
+        _hitRate = hits + misses > 0 ? (double)hits / (hits + misses) : 0;
+    }
+    return self;
+}
+@end
+
+@implementation SealdCacheStats
+- (instancetype) initWithFlows:(NSDictionary<NSNumber*, SealdCacheFlowStats*>*)flows
+                         total:(SealdCacheFlowStats*)total
+                 memoryEntries:(NSInteger)memoryEntries
+                 pinnedEntries:(NSInteger)pinnedEntries
+                  storeEntries:(NSInteger)storeEntries
+                     storeSize:(NSInteger)storeSize
+              expiredEvictions:(NSInteger)expiredEvictions
+             capacityEvictions:(NSInteger)capacityEvictions
+                 invalidations:(NSInteger)invalidations
+                storeEvictions:(NSInteger)storeEvictions
+{
+    self = [super init];
+    if (self) {
+        _direct = flows[@(SealdEncryptionSessionRetrievalDirect)];
+        _viaGroup = flows[@(SealdEncryptionSessionRetrievalViaGroup)];
+        _viaProxy = flows[@(SealdEncryptionSessionRetrievalViaProxy)];
+        _viaSymEncKey = flows[@(SealdEncryptionSessionRetrievalViaSymEncKey)];
+        _viaTmrAccess = flows[@(SealdEncryptionSessionRetrievalViaTmrAccess)];
+        _total = total;
+        _memoryEntries = memoryEntries;
+        _pinnedEntries = pinnedEntries;
+        _storeEntries = storeEntries;
+        _storeSize = storeSize;
+        _expiredEvictions = expiredEvictions;
+        _capacityEvictions = capacityEvictions;
+        _invalidations = invalidations;
+        _storeEvictions = storeEvictions;
+    }
+    return self;
+}
+@end
+
+@implementation SealdCacheEntryInfo
+- (instancetype) initWithSessionId:(NSString*)sessionId
+                  retrievalDetails:(SealdEncryptionSessionRetrievalDetails*)retrievalDetails
+                            pinned:(BOOL)pinned
+                         expiresAt:(NSDate*_Nullable)expiresAt
+{
+    self = [super init];
+    if (self) {
+        _sessionId = sessionId;
+        _retrievalDetails = retrievalDetails;
+        _pinned = pinned;
+        _expiresAt = expiresAt;
+    }
+    return self;
+}
+@end
+
 @implementation SealdGetSigchainResponse
 - (instancetype) initWithSigchainHash:(NSString*)sigchainHash
                              position:(NSInteger)position
@@ -763,7 +1044,7 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
 
 + (NSArray<SealdSymEncKey*>*) fromMobileSdkArray:(SealdSdkInternalsMobile_sdkRecipientsList*)nativeList
 {
-    NSMutableArray<SealdSymEncKey*>* result = [NSMutableArray array];
+    NSMutableArray<SealdSymEncKey*>* result = [NSMutableArray arrayWithCapacity:nativeList.symEncKeysSize];
     for (NSInteger i = 0; i < nativeList.symEncKeysSize; i++) {
         SealdSymEncKey* key = [self fromMobileSdk:[nativeList getSymEncKey:(long)i]];
         [result addObject:key];
@@ -797,7 +1078,7 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
 
 + (NSArray<SealdProxySession*>*) fromMobileSdkArray:(SealdSdkInternalsMobile_sdkRecipientsList*)nativeList
 {
-    NSMutableArray<SealdProxySession*>* result = [NSMutableArray array];
+    NSMutableArray<SealdProxySession*>* result = [NSMutableArray arrayWithCapacity:nativeList.proxySessionsSize];
     for (NSInteger i = 0; i < nativeList.proxySessionsSize; i++) {
         SealdProxySession* session = [self fromMobileSdk:[nativeList getProxySession:(long)i]];
         [result addObject:session];
@@ -834,7 +1115,7 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
 
 + (NSArray<SealdTmrAccess*>*) fromMobileSdkArray:(SealdSdkInternalsMobile_sdkRecipientsList*)nativeList
 {
-    NSMutableArray<SealdTmrAccess*>* result = [NSMutableArray array];
+    NSMutableArray<SealdTmrAccess*>* result = [NSMutableArray arrayWithCapacity:nativeList.tmrAccessesSize];
     for (NSInteger i = 0; i < nativeList.tmrAccessesSize; i++) {
         SealdTmrAccess* access = [self fromMobileSdk:[nativeList getTmrAccess:(long)i]];
         [result addObject:access];
@@ -878,7 +1159,7 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
 
 + (NSArray<SealdSealdRecipient*>*) fromMobileSdkArray:(SealdSdkInternalsMobile_sdkRecipientsList*)nativeList
 {
-    NSMutableArray<SealdSealdRecipient*>* result = [NSMutableArray array];
+    NSMutableArray<SealdSealdRecipient*>* result = [NSMutableArray arrayWithCapacity:nativeList.sealdRecipientsSize];
     for (NSInteger i = 0; i < nativeList.sealdRecipientsSize; i++) {
         SealdSealdRecipient* recipient = [self fromMobileSdk:[nativeList getSealdRecipient:(long)i]];
         [result addObject:recipient];
@@ -917,3 +1198,78 @@ NSArray<NSString*>* stringArrayToArray(SealdSdkInternalsMobile_sdkStringArray* s
                                                      symEncKeys:symEncKeys];
 }
 @end
+
+@implementation SealdPagedRecipientsList {
+    SealdSdkInternalsMobile_sdkRecipientsList* nativeList;
+}
+
+- (instancetype) initWithMobileSdk:(SealdSdkInternalsMobile_sdkRecipientsList*)list
+{
+    self = [super init];
+    if (self) {
+        nativeList = list;
+        _sealdRecipientsCount = list.sealdRecipientsSize;
+        _tmrAccessesCount = list.tmrAccessesSize;
+        _proxySessionsCount = list.proxySessionsSize;
+        _symEncKeysCount = list.symEncKeysSize;
+    }
+    return self;
+}
+
+static NSArray* convertRange(NSRange range, NSInteger count, id (^convert)(long i))
+{
+    NSUInteger start = MIN(range.location, (NSUInteger)count);
+    NSUInteger length = MIN(range.length, (NSUInteger)count - start);
+    NSMutableArray* result = [NSMutableArray arrayWithCapacity:length];
+    for (NSUInteger i = start; i < start + length; i++) {
+        [result addObject:convert((long)i)];
+    }
+    return result;
+}
+
+- (NSArray<SealdSealdRecipient*>*) sealdRecipientsInRange:(NSRange)range
+{
+    return convertRange(range, self.sealdRecipientsCount, ^id (long i) {
+        return [SealdSealdRecipient fromMobileSdk:[self->nativeList getSealdRecipient:i]];
+    });
+}
+
+- (NSArray<SealdTmrAccess*>*) tmrAccessesInRange:(NSRange)range
+{
+    return convertRange(range, self.tmrAccessesCount, ^id (long i) {
+        return [SealdTmrAccess fromMobileSdk:[self->nativeList getTmrAccess:i]];
+    });
+}
+
+- (NSArray<SealdProxySession*>*) proxySessionsInRange:(NSRange)range
+{
+    return convertRange(range, self.proxySessionsCount, ^id (long i) {
+        return [SealdProxySession fromMobileSdk:[self->nativeList getProxySession:i]];
+    });
+}
+
+- (NSArray<SealdSymEncKey*>*) symEncKeysInRange:(NSRange)range
+{
+    return convertRange(range, self.symEncKeysCount, ^id (long i) {
+        return [SealdSymEncKey fromMobileSdk:[self->nativeList getSymEncKey:i]];
+    });
+}
+
+- (void) enumerateSealdRecipientsWithPageSize:(NSInteger)pageSize
+                                   usingBlock:(void (^)(NSArray<SealdSealdRecipient*>* page, BOOL* stop))block
+{
+    // Pages hold at least one recipient, so that each iteration advances.
+    NSInteger size = MAX(pageSize, 1);
+    BOOL stop = NO;
+    for (NSInteger start = 0; start < self.sealdRecipientsCount && !stop; start += size) {
+        @autoreleasepool {
+            block([self sealdRecipientsInRange:NSMakeRange(start, size)], &stop);
+        }
+    }
+}
+
+- (SealdRecipientsList*) toRecipientsList
+{
+    return [SealdRecipientsList fromMobileSdk:nativeList];
+}
+@end
@@ -0,0 +1,44 @@
+//
+//  SealdCacheStatsCollector.h
+//  SealdSdk
+//
+//  Created by Seald SAS on 18/10/2026.
+//  Copyright © 2026 Seald SAS. All rights reserved.
+//
+
+#ifndef SealdCacheStatsCollector_h
+#define SealdCacheStatsCollector_h
+
+#import <Foundation/Foundation.h>
+#import "Helpers.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** \cond */
+/**
+ * SealdCacheSource is where a retrieved encryption session came from.
+ */
+typedef NS_ENUM (NSInteger, SealdCacheSource) {
+    SealdCacheSourceMemory = 0,
+    SealdCacheSourceStore = 1,
+    SealdCacheSourceNativeCache = 2,
+    SealdCacheSourceNetwork = 3,
+};
+
+/**
+ * SealdCacheStatsCollector counts encryption session retrievals by flow and by source, for SealdSdk.getCacheStats.
+ */
+@interface SealdCacheStatsCollector : NSObject
+/** Sessions created locally are not counted. */
+- (void) recordRetrievalWithFlow:(SealdEncryptionSessionRetrievalFlow)flow
+                          source:(SealdCacheSource)source;
+/** Counters of each flow, keyed by SealdEncryptionSessionRetrievalFlow. */
+- (NSDictionary<NSNumber*, SealdCacheFlowStats*>*) flowStats;
+- (SealdCacheFlowStats*) totalStats;
+- (void) reset;
+@end
+/** \endcond */
+
+NS_ASSUME_NONNULL_END
+
+#endif /* SealdCacheStatsCollector_h */
@@ -0,0 +1,70 @@
+//
+//  SealdCacheStatsCollector.m
+//  SealdSdk
+//
+//  Created by Seald SAS on 18/10/2026.
+//  Copyright © 2026 Seald SAS. All rights reserved.
+//
+
+#import "SealdCacheStatsCollector.h"
+
+// SealdEncryptionSessionRetrievalFlow values go from 0 to 6. An enum, so that they can size the counters array.
+enum {
+    flowsCount = 7,
+    sourcesCount = 4,
+};
+
+static SealdCacheFlowStats* flowStatsFromCounters(const NSInteger* counters)
+{
+    return [[SealdCacheFlowStats alloc] initWithMemoryHits:counters[SealdCacheSourceMemory]
+                                                 storeHits:counters[SealdCacheSourceStore]
+                                           nativeCacheHits:counters[SealdCacheSourceNativeCache]
+                                                    misses:counters[SealdCacheSourceNetwork]];
+}
+
+@implementation SealdCacheStatsCollector {
+    NSInteger counters[flowsCount][sourcesCount];
+}
+
+- (void) recordRetrievalWithFlow:(SealdEncryptionSessionRetrievalFlow)flow
+                          source:(SealdCacheSource)source
+{
+    if (flow == SealdEncryptionSessionRetrievalCreated || flow < 0 || flow >= flowsCount) {
+        return;
+    }
+    @synchronized (self) {
+        counters[flow][source]++;
+    }
+}
+
+- (NSDictionary<NSNumber*, SealdCacheFlowStats*>*) flowStats
+{
+    NSMutableDictionary<NSNumber*, SealdCacheFlowStats*>* res = [NSMutableDictionary dictionaryWithCapacity:flowsCount];
+    @synchronized (self) {
+        for (NSInteger flow = 0; flow < flowsCount; flow++) {
+            res[@(flow)] = flowStatsFromCounters(counters[flow]);
+        }
+    }
+    return res;
+}
+
+- (SealdCacheFlowStats*) totalStats
+{
+    NSInteger total[sourcesCount] = {0};
+    @synchronized (self) {
+        for (NSInteger flow = 0; flow < flowsCount; flow++) {
+            for (NSInteger source = 0; source < sourcesCount; source++) {
+                total[source] += counters[flow][source];
+            }
+        }
+    }
+    return flowStatsFromCounters(total);
+}
+
+- (void) reset
+{
+    @synchronized (self) {
+        memset(counters, 0, sizeof(counters));
+    }
+}
+@end
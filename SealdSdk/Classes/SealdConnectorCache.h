@@ -0,0 +1,55 @@
+//
+//  SealdConnectorCache.h
+//  SealdSdk
+//
+//  Created by Seald SAS on 18/10/2026.
+//  Copyright © 2026 Seald SAS. All rights reserved.
+//
+
+#ifndef SealdConnectorCache_h
+#define SealdConnectorCache_h
+
+#import <Foundation/Foundation.h>
+#import "Helpers.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** \cond */
+/**
+ * SealdConnectorCache remembers connector resolutions in both directions, so that contact-heavy screens
+ * do not look up the same connectors again and again. Connectors that are not assigned to any Seald user are cached too,
+ * with the error the lookup returned, for `negativeTTL`. Other entries expire after `ttl`.
+ * Used by SealdSdk when SealdSdkOptions.connectorsCacheTTL is set.
+ */
+@interface SealdConnectorCache : NSObject
+@property (atomic, assign, readonly) NSTimeInterval ttl;
+@property (atomic, assign, readonly) NSTimeInterval negativeTTL;
+- (instancetype) initWithTTL:(NSTimeInterval)ttl
+                 negativeTTL:(NSTimeInterval)negativeTTL;
+/** The key under which a connector is cached. */
++ (NSString*) keyForType:(NSString*)type
+                   value:(NSString*)value;
+/**
+ * Returns the cached Seald ID of a connector, `NSNull` if the connector is cached as unknown, or `nil` if it is not cached or has expired.
+ * For unknown connectors, `unknownError` receives the error of the lookup.
+ */
+- (nullable id) sealdIdForConnectorKey:(NSString*)key
+                          unknownError:(NSError*_Nullable*_Nullable)unknownError;
+- (void) setSealdId:(NSString*)sealdId
+    forConnectorKey:(NSString*)key;
+- (void) setUnknownConnectorKey:(NSString*)key
+                          error:(NSError*)error;
+/** Returns the cached connectors of a Seald ID, or `nil` if they are not cached or have expired. */
+- (nullable NSArray<SealdConnector*>*) connectorsForSealdId:(NSString*)sealdId;
+/** Caches the connectors of a Seald ID, and the Seald ID of each validated connector. */
+- (void) setConnectors:(NSArray<SealdConnector*>*)connectors
+           forSealdId:(NSString*)sealdId;
+/** Caches a list of connectors, possibly of several users, such as returned by SealdSdk.listConnectorsWithError:. */
+- (void) seedWithConnectors:(NSArray<SealdConnector*>*)connectors;
+- (void) removeAll;
+@end
+/** \endcond */
+
+NS_ASSUME_NONNULL_END
+
+#endif /* SealdConnectorCache_h */
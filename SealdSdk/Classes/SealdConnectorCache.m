@@ -0,0 +1,145 @@
+//
+//  SealdConnectorCache.m
+//  SealdSdk
+//
+//  Created by Seald SAS on 18/10/2026.
+//  Copyright © 2026 Seald SAS. All rights reserved.
+//
+
+#import "SealdConnectorCache.h"
+
+// State of the connectors that can be resolved to their Seald ID.
+static NSString* const validatedConnectorState = @"VO";
+
+@interface SealdConnectorCacheEntry : NSObject
+/** A Seald ID, an `NSError` for unknown connectors, or an `NSArray<SealdConnector*>`. */
+@property (nonatomic, strong) id value;
+@property (nonatomic, strong) NSDate* expiresAt;
+@end
+
+@implementation SealdConnectorCacheEntry
+@end
+
+@implementation SealdConnectorCache {
+    NSMutableDictionary<NSString*, SealdConnectorCacheEntry*>* sealdIdsByConnector;
+    NSMutableDictionary<NSString*, SealdConnectorCacheEntry*>* connectorsBySealdId;
+}
+
+- (instancetype) initWithTTL:(NSTimeInterval)ttl
+                 negativeTTL:(NSTimeInterval)negativeTTL
+{
+    self = [super init];
+    if (self) {
+        _ttl = ttl;
+        _negativeTTL = negativeTTL;
+        sealdIdsByConnector = [NSMutableDictionary dictionary];
+        connectorsBySealdId = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
++ (NSString*) keyForType:(NSString*)type
+                   value:(NSString*)value
+{
+    return [NSString stringWithFormat:@"%@:%@", type, value];
+}
+
+// Must be called while holding the lock on `self`.
+// Returns the entry if it has not expired, and removes it otherwise.
+- (SealdConnectorCacheEntry*) _liveEntryForKey:(NSString*)key
+                                  inDictionary:(NSMutableDictionary<NSString*, SealdConnectorCacheEntry*>*)dictionary
+{
+    SealdConnectorCacheEntry* entry = dictionary[key];
+    if (entry != nil && [entry.expiresAt timeIntervalSinceNow] <= 0) {
+        [dictionary removeObjectForKey:key];
+        return nil;
+    }
+    return entry;
+}
+
+// Must be called while holding the lock on `self`.
+- (void) _setValue:(id)value
+            forKey:(NSString*)key
+               ttl:(NSTimeInterval)ttl
+      inDictionary:(NSMutableDictionary<NSString*, SealdConnectorCacheEntry*>*)dictionary
+{
+    if (ttl <= 0) {
+        return;
+    }
+    SealdConnectorCacheEntry* entry = [[SealdConnectorCacheEntry alloc] init];
+    entry.value = value;
+    entry.expiresAt = [NSDate dateWithTimeIntervalSinceNow:ttl];
+    dictionary[key] = entry;
+}
+
+- (nullable id) sealdIdForConnectorKey:(NSString*)key
+                          unknownError:(NSError*_Nullable*_Nullable)unknownError
+{
+    @synchronized (self) {
+        SealdConnectorCacheEntry* entry = [self _liveEntryForKey:key inDictionary:sealdIdsByConnector];
+        if ([entry.value isKindOfClass:[NSError class]]) {
+            if (unknownError) *unknownError = entry.value;
+            return [NSNull null];
+        }
+        return entry.value;
+    }
+}
+
+- (void) setSealdId:(NSString*)sealdId
+    forConnectorKey:(NSString*)key
+{
+    @synchronized (self) {
+        [self _setValue:sealdId forKey:key ttl:self.ttl inDictionary:sealdIdsByConnector];
+    }
+}
+
+- (void) setUnknownConnectorKey:(NSString*)key
+                          error:(NSError*)error
+{
+    @synchronized (self) {
+        [self _setValue:error forKey:key ttl:self.negativeTTL inDictionary:sealdIdsByConnector];
+    }
+}
+
+- (nullable NSArray<SealdConnector*>*) connectorsForSealdId:(NSString*)sealdId
+{
+    @synchronized (self) {
+        return [self _liveEntryForKey:sealdId inDictionary:connectorsBySealdId].value;
+    }
+}
+
+- (void) setConnectors:(NSArray<SealdConnector*>*)connectors
+           forSealdId:(NSString*)sealdId
+{
+    @synchronized (self) {
+        [self _setValue:connectors forKey:sealdId ttl:self.ttl inDictionary:connectorsBySealdId];
+        for (SealdConnector* c in connectors) {
+            if ([c.state isEqualToString:validatedConnectorState]) {
+                [self _setValue:sealdId forKey:[SealdConnectorCache keyForType:c.type value:c.value] ttl:self.ttl inDictionary:sealdIdsByConnector];
+            }
+        }
+    }
+}
+
+- (void) seedWithConnectors:(NSArray<SealdConnector*>*)connectors
+{
+    NSMutableDictionary<NSString*, NSMutableArray<SealdConnector*>*>* bySealdId = [NSMutableDictionary dictionary];
+    for (SealdConnector* c in connectors) {
+        if (bySealdId[c.sealdId] == nil) {
+            bySealdId[c.sealdId] = [NSMutableArray array];
+        }
+        [bySealdId[c.sealdId] addObject:c];
+    }
+    for (NSString* sealdId in bySealdId) {
+        [self setConnectors:bySealdId[sealdId] forSealdId:sealdId];
+    }
+}
+
+- (void) removeAll
+{
+    @synchronized (self) {
+        [sealdIdsByConnector removeAllObjects];
+        [connectorsBySealdId removeAllObjects];
+    }
+}
+@end
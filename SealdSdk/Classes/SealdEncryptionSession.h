@@ -30,9 +30,20 @@ NS_ASSUME_NONNULL_BEGIN
 /** Details about how this session was retrieved: through a group, a proxy, or directly. Read-only. */
 @property (atomic, readonly) SealdEncryptionSessionRetrievalDetails* retrievalDetails;
 /** \cond */
+/**
+ * Called after a revocation that may remove the access of the current user, so that the SDK can invalidate what it keeps of this session.
+ * `sealdIds` and `proxySessionsIds` are the revoked recipients, or both `nil` after revokeAll:.
+ */
+@property (atomic, copy, nullable) void (^onRevoke)(NSString* sessionId, NSArray<NSString*>*_Nullable sealdIds, NSArray<NSString*>*_Nullable proxySessionsIds);
 - (instancetype) initWithEncryptionSession:(const SealdSdkInternalsMobile_sdkMobileEncryptionSession*)es;
 + (instancetype) fromMobileSdk:(SealdSdkInternalsMobile_sdkMobileEncryptionSession*)es;
 + (NSArray<SealdEncryptionSession*>*) fromMobileSdkArray:(SealdSdkInternalsMobile_sdkMobileEncryptionSessionArray*)array;
+- (NSDictionary<NSString*, SealdActionStatus*>*) _addMultipleNativeTmrAccesses:(SealdSdkInternalsMobile_sdkTmrRecipientWithRightsArray*)nativeRecipients
+                                                                         error:(NSError*_Nullable*)error;
+- (SealdSetRecipientsResult*) _setRecipients:(NSArray<NSString*>*)sealdIds
+                                      rights:(SealdRecipientRights*_Nullable)rights
+                                   keepingId:(NSString*_Nullable)keptId
+                                       error:(NSError*_Nullable*)error;
 /** \endcond */
 
 /**
@@ -186,6 +197,57 @@ NS_ASSUME_NONNULL_BEGIN
  * @param completionHandler A callback called after function execution. This callback takes two arguments, a SealdRecipientsList instance. and a `NSError*` that indicates if any error occurred.
  */
 - (void) listRecipientsAsyncWithCompletionHandler:(void (^)(SealdRecipientsList* result, NSError*_Nullable error))completionHandler;
+
+/**
+ * List all recipients from this session, without converting them upfront.
+ * The whole list is fetched from the server, as with listRecipients:. Recipients are only converted to Objective-C objects
+ * when read from the returned SealdPagedRecipientsList, which is faster and uses less memory than listRecipients: for sessions with many recipients.
+ *
+ * @return A SealdPagedRecipientsList instance.
+ */
+- (SealdPagedRecipientsList*) listRecipientsPaged:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
+
+/**
+ * List all recipients from this session, without converting them upfront.
+ * The whole list is fetched from the server, as with listRecipients:. Recipients are only converted to Objective-C objects
+ * when read from the returned SealdPagedRecipientsList, which is faster and uses less memory than listRecipients: for sessions with many recipients.
+ *
+ * @param completionHandler A callback called after function execution. This callback takes two arguments, a SealdPagedRecipientsList instance, and a `NSError*` that indicates if any error occurred.
+ */
+- (void) listRecipientsPagedAsyncWithCompletionHandler:(void (^)(SealdPagedRecipientsList* result, NSError*_Nullable error))completionHandler;
+
+/**
+ * Make the Seald recipients of this session exactly `sealdIds`, with `rights`: missing recipients are added,
+ * Seald recipients that are not in `sealdIds` are revoked, and recipients with other rights are revoked then added again with `rights`,
+ * so they cannot access the session in between. Proxy sessions, TMR accesses and symmetric keys are left untouched.
+ * This takes one call to list recipients, plus at most one call to add missing recipients, one call to revoke, and one call to add again recipients whose rights changed.
+ * If a call fails after an earlier one was applied, the result describes the applied changes, and its `error` property is set.
+ * Warning: to keep access to this session, include your own Seald ID in `sealdIds`.
+ *
+ * @param sealdIds The Seald IDs of users and groups that should be the recipients of this session.
+ * @param rights The rights the recipients should have, or `nil` for default rights.
+ * @param error The error that occurred, if any.
+ * @return A SealdSetRecipientsResult describing the changes that were made.
+ */
+- (SealdSetRecipientsResult*) setRecipients:(const NSArray<NSString*>*)sealdIds
+                                     rights:(const SealdRecipientRights*_Nullable)rights
+                                      error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
+
+/**
+ * Make the Seald recipients of this session exactly `sealdIds`, with `rights`: missing recipients are added,
+ * Seald recipients that are not in `sealdIds` are revoked, and recipients with other rights are revoked then added again with `rights`,
+ * so they cannot access the session in between. Proxy sessions, TMR accesses and symmetric keys are left untouched.
+ * This takes one call to list recipients, plus at most one call to add missing recipients, one call to revoke, and one call to add again recipients whose rights changed.
+ * If a call fails after an earlier one was applied, the result describes the applied changes, and its `error` property is set.
+ * Warning: to keep access to this session, include your own Seald ID in `sealdIds`.
+ *
+ * @param sealdIds The Seald IDs of users and groups that should be the recipients of this session.
+ * @param rights The rights the recipients should have, or `nil` for default rights.
+ * @param completionHandler A callback called after function execution. This callback takes two arguments, a SealdSetRecipientsResult instance, and a `NSError*` that indicates if any error occurred.
+ */
+- (void) setRecipientsAsync:(const NSArray<NSString*>*)sealdIds
+                     rights:(const SealdRecipientRights*_Nullable)rights
+          completionHandler:(void (^)(SealdSetRecipientsResult* result, NSError*_Nullable error))completionHandler;
 /**
  * Encrypt a clear-text string into an encrypted message, for the recipients of this session.
  *
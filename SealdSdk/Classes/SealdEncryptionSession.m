@@ -132,11 +132,14 @@
     rtr.tmrAccessAuthFactors = [SealdTmrAuthFactor toMobileSdkArray:tmrAccessAuthFactors];
 
 
-    SealdSdkInternalsMobile_sdkRevokeResult* resp = [encryptionSession revokeRecipients:rtr error:error];
+    SealdSdkInternalsMobile_sdkRevokeResult* resp = [encryptionSession revokeRecipients:rtr error:&localErr];
     if (localErr) {
         _SealdInternal_ConvertError(localErr, error);
         return nil;
     }
+    if (self.onRevoke) {
+        self.onRevoke(self.sessionId, (NSArray<NSString*>*)sealdIds ?: @[], (NSArray<NSString*>*)proxySessionsIds ?: @[]);
+    }
     return [SealdRevokeResult fromMobileSdk:resp];
 }
 
@@ -162,6 +165,9 @@
         _SealdInternal_ConvertError(localErr, error);
         return nil;
     }
+    if (self.onRevoke) {
+        self.onRevoke(self.sessionId, nil, nil);
+    }
     return [SealdRevokeResult fromMobileSdk:resp];
 }
 
@@ -214,6 +220,126 @@
     });
 }
 
+- (SealdPagedRecipientsList*) listRecipientsPaged:(NSError*_Nullable*)error
+{
+    NSError* localErr = nil;
+    SealdSdkInternalsMobile_sdkRecipientsList* resp = [encryptionSession listRecipients:&localErr];
+    if (localErr) {
+        _SealdInternal_ConvertError(localErr, error);
+        return nil;
+    }
+    return [[SealdPagedRecipientsList alloc] initWithMobileSdk:resp];
+}
+
+- (void) listRecipientsPagedAsyncWithCompletionHandler:(void (^)(SealdPagedRecipientsList* result, NSError*_Nullable error))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSError* localError = nil;
+        SealdPagedRecipientsList* result = [self listRecipientsPaged:&localError];
+        completionHandler(result, localError);
+    });
+}
+
+- (SealdSetRecipientsResult*) setRecipients:(const NSArray<NSString*>*)sealdIds
+                                     rights:(const SealdRecipientRights*_Nullable)rights
+                                      error:(NSError*_Nullable*)error
+{
+    return [self _setRecipients:(NSArray<NSString*>*)sealdIds rights:(SealdRecipientRights*)rights keepingId:nil error:error];
+}
+
+// `keptId`, if set, is never revoked, even if it is not in `sealdIds`.
+- (SealdSetRecipientsResult*) _setRecipients:(NSArray<NSString*>*)sealdIds
+                                      rights:(SealdRecipientRights*_Nullable)rights
+                                   keepingId:(NSString*_Nullable)keptId
+                                       error:(NSError*_Nullable*)error
+{
+    NSError* localErr = nil;
+    SealdSdkInternalsMobile_sdkRecipientsList* current = [encryptionSession listRecipients:&localErr];
+    if (localErr) {
+        _SealdInternal_ConvertError(localErr, error);
+        return nil;
+    }
+
+    // The native core cannot change the rights of a recipient: recipients whose rights differ are revoked, then added again with `rights`.
+    SealdRecipientRights* wantedRights = rights ?: [[SealdRecipientRights alloc] initWithDefaultRights];
+    NSSet<NSString*>* wanted = [NSSet setWithArray:sealdIds];
+    NSMutableSet<NSString*>* existing = [NSMutableSet set];
+    NSMutableArray<NSString*>* toRevoke = [NSMutableArray array];
+    NSMutableArray<SealdRecipientWithRights*>* toReAdd = [NSMutableArray array];
+    for (long i = 0; i < current.sealdRecipientsSize; i++) {
+        SealdSdkInternalsMobile_sdkSealdRecipient* recipient = [current getSealdRecipient:i];
+        [existing addObject:recipient.sealdId];
+        if ([recipient.sealdId isEqualToString:keptId]) {
+            continue;
+        }
+        if (![wanted containsObject:recipient.sealdId]) {
+            [toRevoke addObject:recipient.sealdId];
+        } else if (recipient.rights != nil
+                   && (recipient.rights.read != wantedRights.read || recipient.rights.forward != wantedRights.forward || recipient.rights.revoke != wantedRights.revoke)) {
+            [toRevoke addObject:recipient.sealdId];
+            [toReAdd addObject:[[SealdRecipientWithRights alloc] initWithRecipientId:recipient.sealdId rights:wantedRights]];
+        }
+    }
+    NSMutableArray<SealdRecipientWithRights*>* toAdd = [NSMutableArray array];
+    for (NSString* sealdId in wanted) {
+        if (![existing containsObject:sealdId]) {
+            [toAdd addObject:[[SealdRecipientWithRights alloc] initWithRecipientId:sealdId rights:rights]];
+        }
+    }
+
+    // Once a step has been applied, a failure of the next one is returned in the result, so that the caller knows what was changed.
+    NSDictionary<NSString*, SealdActionStatus*>* added = @{};
+    if ([toAdd count] > 0) {
+        added = [self addRecipients:toAdd error:&localErr];
+        if (localErr) {
+            if (error) *error = localErr;
+            return nil;
+        }
+    }
+    SealdRevokeResult* revoked = nil;
+    if ([toRevoke count] > 0) {
+        revoked = [self revokeRecipientsWithSealdIds:toRevoke proxySessionsIds:nil symEncKeysIds:nil tmrAccessIds:nil tmrAccessAuthFactors:nil error:&localErr];
+        if (localErr) {
+            if ([toAdd count] == 0) {
+                if (error) *error = localErr;
+                return nil;
+            }
+            return [[SealdSetRecipientsResult alloc] initWithAdded:added revoked:nil rightsChanged:@{} error:localErr];
+        }
+    }
+    NSMutableDictionary<NSString*, SealdActionStatus*>* rightsChanged = [NSMutableDictionary dictionary];
+    NSMutableArray<SealdRecipientWithRights*>* revokedToReAdd = [NSMutableArray array];
+    for (SealdRecipientWithRights* r in toReAdd) {
+        SealdActionStatus* revokeStatus = revoked.recipients[r.recipientId];
+        if (revokeStatus != nil && !revokeStatus.success) {
+            rightsChanged[r.recipientId] = revokeStatus;
+        } else {
+            [revokedToReAdd addObject:r];
+        }
+    }
+    if ([revokedToReAdd count] > 0) {
+        NSDictionary<NSString*, SealdActionStatus*>* reAdded = [self addRecipients:revokedToReAdd error:&localErr];
+        if (localErr) {
+            return [[SealdSetRecipientsResult alloc] initWithAdded:added revoked:revoked rightsChanged:rightsChanged error:localErr];
+        }
+        [rightsChanged addEntriesFromDictionary:reAdded];
+    }
+    return [[SealdSetRecipientsResult alloc] initWithAdded:added revoked:revoked rightsChanged:rightsChanged error:nil];
+}
+
+- (void) setRecipientsAsync:(const NSArray<NSString*>*)sealdIds
+                     rights:(const SealdRecipientRights*_Nullable)rights
+          completionHandler:(void (^)(SealdSetRecipientsResult* result, NSError*_Nullable error))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSError* localError = nil;
+        SealdSetRecipientsResult* result = [self setRecipients:sealdIds
+                                                        rights:rights
+                                                         error:&localError];
+        completionHandler(result, localError);
+    });
+}
+
 - (NSString*) encryptMessage:(const NSString*)clearMessage
                        error:(NSError*_Nullable*)error
 {
@@ -381,7 +507,15 @@
         _SealdInternal_ConvertError(localErr, error);
         return nil;
     }
-    SealdSdkInternalsMobile_sdkActionStatusArray* resp = [encryptionSession addMultipleTmrAccesses:nativeR error:&localErr];
+    return [self _addMultipleNativeTmrAccesses:nativeR error:error];
+}
+
+// Takes recipients already converted, so that callers adding the same recipients to many sessions convert them only once.
+- (NSDictionary<NSString*, SealdActionStatus*>*) _addMultipleNativeTmrAccesses:(SealdSdkInternalsMobile_sdkTmrRecipientWithRightsArray*)nativeRecipients
+                                                                         error:(NSError*_Nullable*)error
+{
+    NSError* localErr = nil;
+    SealdSdkInternalsMobile_sdkActionStatusArray* resp = [encryptionSession addMultipleTmrAccesses:nativeRecipients error:&localErr];
     if (localErr) {
         _SealdInternal_ConvertError(localErr, error);
         return nil;
@@ -0,0 +1,48 @@
+//
+//  SealdEncryptionSessionPool.h
+//  SealdSdk
+//
+//  Created by Seald SAS on 18/10/2026.
+//  Copyright © 2026 Seald SAS. All rights reserved.
+//
+
+#ifndef SealdEncryptionSessionPool_h
+#define SealdEncryptionSessionPool_h
+
+#import <Foundation/Foundation.h>
+#import "Helpers.h"
+#import "SealdEncryptionSession.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** \cond */
+/**
+ * SealdEncryptionSessionPool keeps ready-made encryption sessions for one recipient set,
+ * refilled in the background. Used by SealdSdk.registerEncryptionSessionPoolWithRecipients:metadata:size:maxAge:onRefillError:.
+ */
+@interface SealdEncryptionSessionPool : NSObject
+@property (atomic, strong, readonly) NSArray<SealdRecipientWithRights*>* recipients;
+@property (atomic, strong, readonly, nullable) NSString* metadata;
+@property (atomic, assign, readonly) NSInteger size;
+@property (atomic, assign, readonly) NSTimeInterval maxAge;
+- (instancetype) initWithRecipients:(NSArray<SealdRecipientWithRights*>*)recipients
+                           metadata:(NSString*_Nullable)metadata
+                               size:(NSInteger)size
+                             maxAge:(NSTimeInterval)maxAge
+                      createSession:(SealdEncryptionSession*_Nullable (^)(NSError*_Nullable* error))createSession
+                      onRefillError:(void (^_Nullable)(NSError* error))onRefillError;
+/** Returns a pooled session younger than `maxAge` and schedules a refill, or `nil` if the pool is empty. */
+- (nullable SealdEncryptionSession*) take;
+/** Schedules a background refill up to `size` sessions. If a creation fails, the refill stops until the next take, and `onRefillError` is called with the error. */
+- (void) refill;
+/** Discards all pooled sessions and stops refilling. */
+- (void) drain;
+/** The key identifying a recipient set, independent of the order of recipients. */
++ (NSString*) keyForRecipients:(const NSArray<SealdRecipientWithRights*>*)recipients
+                      metadata:(const NSString*_Nullable)metadata;
+@end
+/** \endcond */
+
+NS_ASSUME_NONNULL_END
+
+#endif /* SealdEncryptionSessionPool_h */
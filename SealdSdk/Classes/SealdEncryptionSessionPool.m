@@ -0,0 +1,135 @@
+//
+//  SealdEncryptionSessionPool.m
+//  SealdSdk
+//
+//  Created by Seald SAS on 18/10/2026.
+//  Copyright © 2026 Seald SAS. All rights reserved.
+//
+
+#import "SealdEncryptionSessionPool.h"
+
+@implementation SealdEncryptionSessionPool {
+    SealdEncryptionSession*_Nullable (^createSession)(NSError*_Nullable* error);
+    void (^onRefillError)(NSError* error);
+    NSMutableArray<SealdEncryptionSession*>* sessions;
+    NSMutableArray<NSDate*>* creationDates;
+    dispatch_queue_t refillQueue;
+    BOOL refilling;
+    BOOL drained;
+}
+
+- (instancetype) initWithRecipients:(NSArray<SealdRecipientWithRights*>*)recipients
+                           metadata:(NSString*_Nullable)metadata
+                               size:(NSInteger)size
+                             maxAge:(NSTimeInterval)maxAge
+                      createSession:(SealdEncryptionSession*_Nullable (^)(NSError*_Nullable* error))createSessionBlock
+                      onRefillError:(void (^_Nullable)(NSError* error))onRefillErrorBlock
+{
+    self = [super init];
+    if (self) {
+        _recipients = recipients;
+        _metadata = metadata;
+        _size = size;
+        _maxAge = maxAge;
+        createSession = createSessionBlock;
+        onRefillError = onRefillErrorBlock;
+        sessions = [NSMutableArray arrayWithCapacity:size];
+        creationDates = [NSMutableArray arrayWithCapacity:size];
+        refillQueue = dispatch_queue_create("io.seald.SealdEncryptionSessionPool.refill", dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0));
+        refilling = NO;
+        drained = NO;
+    }
+    return self;
+}
+
+// Must be called while holding the lock on `sessions`.
+- (void) _dropExpired
+{
+    if (self.maxAge <= 0) {
+        return;
+    }
+    NSDate* limit = [NSDate dateWithTimeIntervalSinceNow:-self.maxAge];
+    while ([creationDates count] > 0 && [creationDates[0] compare:limit] == NSOrderedAscending) {
+        [creationDates removeObjectAtIndex:0];
+        [sessions removeObjectAtIndex:0];
+    }
+}
+
+- (nullable SealdEncryptionSession*) take
+{
+    SealdEncryptionSession* res = nil;
+    @synchronized (sessions) {
+        [self _dropExpired];
+        if ([sessions count] > 0) {
+            res = sessions[0];
+            [sessions removeObjectAtIndex:0];
+            [creationDates removeObjectAtIndex:0];
+        }
+    }
+    [self refill];
+    return res;
+}
+
+- (void) refill
+{
+    @synchronized (sessions) {
+        if (refilling || drained) {
+            return;
+        }
+        refilling = YES;
+    }
+    dispatch_async(refillQueue, ^{
+        while (YES) {
+            @synchronized (self->sessions) {
+                [self _dropExpired];
+                if (self->drained || [self->sessions count] >= self.size) {
+                    self->refilling = NO;
+                    return;
+                }
+            }
+            NSError* localErr = nil;
+            SealdEncryptionSession* es = self->createSession(&localErr);
+            if (localErr || es == nil) {
+                // Give up until the next take: the caller falls back to creating sessions synchronously.
+                @synchronized (self->sessions) {
+                    self->refilling = NO;
+                }
+                if (self->onRefillError != nil) {
+                    self->onRefillError(localErr);
+                }
+                return;
+            }
+            @synchronized (self->sessions) {
+                if (!self->drained) {
+                    [self->sessions addObject:es];
+                    [self->creationDates addObject:[NSDate date]];
+                }
+            }
+        }
+    });
+}
+
+- (void) drain
+{
+    @synchronized (sessions) {
+        drained = YES;
+        [sessions removeAllObjects];
+        [creationDates removeAllObjects];
+    }
+}
+
++ (NSString*) keyForRecipients:(const NSArray<SealdRecipientWithRights*>*)recipients
+                      metadata:(const NSString*_Nullable)metadata
+{
+    NSMutableArray<NSString*>* parts = [NSMutableArray arrayWithCapacity:[recipients count]];
+    for (SealdRecipientWithRights* r in recipients) {
+        if (r.rights == nil) {
+            [parts addObject:[NSString stringWithFormat:@"%@:default", r.recipientId]];
+        } else {
+            [parts addObject:[NSString stringWithFormat:@"%@:%d%d%d", r.recipientId, r.rights.read, r.rights.forward, r.rights.revoke]];
+        }
+    }
+    [parts sortUsingSelector:@selector(compare:)];
+    return [NSString stringWithFormat:@"%@|%@", [parts componentsJoinedByString:@","], metadata ?: @""];
+}
+@end
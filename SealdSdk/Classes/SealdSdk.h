@@ -18,6 +18,11 @@
 #import "SealdAnonymousSdk.h"
 #import "SealdSsksPasswordPlugin.h"
 #import "SealdSsksTMRPlugin.h"
+#import "SealdEncryptionSessionPool.h"
+#import "SealdSessionStore.h"
+#import "SealdSessionCache.h"
+#import "SealdCacheStatsCollector.h"
+#import "SealdConnectorCache.h"
 #import "Utils.h"
 
 NS_ASSUME_NONNULL_BEGIN
@@ -27,6 +32,59 @@ NS_ASSUME_NONNULL_BEGIN
  */
 FOUNDATION_EXPORT NSString*_Nonnull SealdSdkVersion;
 
+/**
+ * SealdSdkOptions represents advanced options for SealdSdk initialization.
+ */
+@interface SealdSdkOptions : NSObject
+/**
+ * Maximum number of encryption sessions kept in an encrypted on-disk store next to the database, so that they can be retrieved without network,
+ * for example to decrypt recent messages on a cold start. Sessions are stored when retrieved or created with `useCache`, evicted least recently used first,
+ * and invalidated when revoked through this instance. Requires `databasePath` and `databaseEncryptionKey`. `0` to disable the store. Defaults to `0`.
+ * Stored sessions expire like in the memory cache, after `encryptionSessionCacheTTL` or the TTL set for them, and sessions with a TTL of `0` are not stored.
+ * Access revoked by other users or devices is not known to the store: such sessions stay decryptable offline until they are evicted, they expire,
+ * or SealdSdk.pollCacheInvalidationsWithOptions: finds out about the revocation.
+ */
+@property (atomic, assign) NSInteger sessionStoreMaxEntries;
+/**
+ * Called with the errors of the session store that have no caller to return them to, on the queue where they happen:
+ * failures to save a session or the store manifest, which are written in the background,
+ * and a manifest that cannot be read at initialization, which is then ignored: the recent and pinned sessions it listed are forgotten.
+ * The store keeps working after these errors, and a session that failed to be saved is only missing from it. Defaults to `nil`.
+ */
+@property (atomic, copy, nullable) void (^onSessionStoreError)(NSError* error);
+/**
+ * Maximum number of unpinned encryption sessions kept ready in memory, so that repeated retrievals with `useCache` return immediately.
+ * Least recently used sessions are evicted first. Entries expire after `encryptionSessionCacheTTL`, unless a TTL was set for their session
+ * with SealdSdk.setCacheTTL:forEncryptionSessionWithId:. `0` to disable the memory cache. Defaults to `0`.
+ */
+@property (atomic, assign) NSInteger sessionCacheMaxEntries;
+/**
+ * Maximum number of pinned encryption sessions, kept in memory in addition to `sessionCacheMaxEntries`.
+ * Pinned sessions are never evicted, and only expire if a TTL was set for them. Defaults to `100`.
+ */
+@property (atomic, assign) NSInteger pinnedSessionCacheMaxEntries;
+/**
+ * Number of the most recently used sessions of the session store to load into the memory cache on a background thread right after initialization,
+ * in addition to the pinned sessions, so that the first decryptions after launch do not have to wait for them.
+ * Requires `sessionStoreMaxEntries` and `sessionCacheMaxEntries`. `0` to disable warm-up. Defaults to `0`.
+ */
+@property (atomic, assign) NSInteger warmUpSessionCount;
+/**
+ * How long connector lookups done with `useCache` are kept in memory, in both directions: connectors to Seald IDs and Seald IDs to connectors.
+ * The cache is also filled by SealdSdk.listConnectorsWithError: and SealdSdk.seedConnectorsCacheWithConnectors:. `0` to disable the cache. Defaults to `0`.
+ */
+@property (atomic, assign) NSTimeInterval connectorsCacheTTL;
+/**
+ * How long connectors that are not assigned to any Seald user are remembered as such, when `connectorsCacheTTL` is set.
+ * `0` to always look them up again. Defaults to 1 minute.
+ */
+@property (atomic, assign) NSTimeInterval connectorsNegativeCacheTTL;
+/**
+ * Initialize a SealdSdkOptions instance with default values.
+ */
+- (instancetype) init;
+@end
+
 /**
  * This is the main class for the Seald SDK. It represents an instance of the Seald SDK.
  */
@@ -34,6 +92,21 @@ FOUNDATION_EXPORT NSString*_Nonnull SealdSdkVersion;
     /** \cond */
     SealdSdkInternalsMobile_sdkMobileSDK* sdkInstance;
     NSInteger keySize;
+    SealdSdkOptions* sdkOptions;
+    NSMutableDictionary<NSString*, SealdEncryptionSessionPool*>* sessionPools;
+    dispatch_source_t groupKeyRenewalTimer;
+    SealdGeneratedPrivateKeys* spareGroupKeys;
+    dispatch_source_t keyProvisioningTimer;
+    SealdSessionStore* sessionStore;
+    dispatch_group_t sessionStoreWrites;
+    SealdSessionCache* sessionCache;
+    NSTimeInterval sessionCacheTTL;
+    SealdCancellationToken* warmUpCancellationToken;
+    SealdCacheStatsCollector* cacheStats;
+    dispatch_source_t cacheInvalidationTimer;
+    NSMutableDictionary<NSString*, NSString*>* groupSigchainHashes;
+    NSMutableDictionary<NSString*, NSDate*>* revalidationDates;
+    SealdConnectorCache* connectorCache;
     /** \endcond */
 }
 /**
@@ -60,8 +133,36 @@ FOUNDATION_EXPORT NSString*_Nonnull SealdSdkVersion;
       encryptionSessionCacheTTL:(const NSTimeInterval)encryptionSessionCacheTTL
                         keySize:(const NSInteger)keySize
                           error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
+
+/**
+ * Initialize a Seald SDK Instance.
+ *
+ * @param apiUrl The Seald server for this instance to use. This value is given on your Seald dashboard.
+ * @param appId The ID given by the Seald server to your app. This value is given on your Seald dashboard.
+ * @param databasePath The path where to store the local Seald database. If no path is passed, uses an in-memory only database.
+ * @param databaseEncryptionKey The encryption key with which to encrypt the local Seald database. Required when passing `databasePath`. This **must** be a cryptographically random NSData of 64 bytes.
+ * @param instanceName An arbitrary name to give to this Seald instance. Can be useful for debugging when multiple instances are running in parallel, as it is added to logs.
+ * @param logLevel The minimum level of logs you want. All logs of this level or above will be displayed. `-1`: Trace; `0`: Debug; `1`: Info; `2`: Warn; `3`: Error; `4`: Fatal; `5`: Panic; `6`: NoLevel; `7`: Disabled.
+ * @param logNoColor Should be set to `NO` if you want to enable colors in the log output, `YES` if you don't.
+ * @param encryptionSessionCacheTTL The duration of cache lifetime. `-1` to cache forever. Default to `0` (no cache).
+ * @param keySize The Asymmetric key size for newly generated keys. Defaults to 4096. Warning: for security, it is extremely not recommended to lower this value.
+ * @param options Advanced options for this instance. If `nil`, default options are used.
+ * @param error Error pointer.
+ */
+- (instancetype) initWithApiUrl:(const NSString*)apiUrl
+                          appId:(const NSString*)appId
+                   databasePath:(const NSString*_Nullable)databasePath
+          databaseEncryptionKey:(const NSData*_Nullable)databaseEncryptionKey
+                   instanceName:(const NSString*)instanceName
+                       logLevel:(const NSInteger)logLevel
+                     logNoColor:(const BOOL)logNoColor
+      encryptionSessionCacheTTL:(const NSTimeInterval)encryptionSessionCacheTTL
+                        keySize:(const NSInteger)keySize
+                        options:(SealdSdkOptions*_Nullable)options
+                          error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
 /**
  * Close the current SDK instance. This frees any lock on the current database. After calling close, the instance cannot be used anymore.
+ * When SealdSdkOptions.sessionStoreMaxEntries is set, this waits for the sessions being written to the session store.
  *
  * @param error Error pointer.
  */
@@ -413,6 +514,106 @@ FOUNDATION_EXPORT NSString*_Nonnull SealdSdkVersion;
                                 privateKeys:(nullable SealdGeneratedPrivateKeys*)privateKeys
                           completionHandler:(void (^)(NSError*_Nullable error))completionHandler;
 
+/**
+ * Add many members to a group, in chunks of `options.chunkSize` members sent in parallel.
+ * Use this instead of SealdSdk.addGroupMembersWithGroupId:membersToAdd:adminsToSet:privateKeys:error: for large member lists,
+ * which would otherwise be sent in a single request that may time out.
+ * Chunks that fail with a network or server error are retried up to `options.retries` times; other errors are not retried.
+ * A failed attempt may still have been partly applied by the server: if a retry fails too, all members of the chunk get the error of the retry,
+ * even those already added, so check the members of the group before sending them again.
+ * Chunks that still fail do not prevent other chunks from being added.
+ * Can only be done by a group administrator.
+ *
+ * @param groupId The group in which to add members.
+ * @param membersToAdd The Seald IDs of the members to add to the group.
+ * @param adminsToSet The Seald IDs of the newly added members to also set as group admins.
+ * @param privateKeys Optional. Pre-generated private keys, returned by a call to SealdSdk.generatePrivateKeysWithError:.
+ * @param options Options for this operation. If `nil`, default options are used.
+ * @param progress A callback called after each chunk with the number of members processed so far, or `nil`.
+ * @param error If an error occurs before any member is added, upon return contains an `NSError` object that describes the problem.
+ * @return A dictionary with the status of each member.
+ */
+- (NSDictionary<NSString*, SealdActionStatus*>*) addGroupMembersWithGroupId:(const NSString*)groupId
+                                                               membersToAdd:(const NSArray<NSString*>*)membersToAdd
+                                                                adminsToSet:(const NSArray<NSString*>*)adminsToSet
+                                                                privateKeys:(nullable SealdGeneratedPrivateKeys*)privateKeys
+                                                                    options:(const SealdGroupMembersOptions*_Nullable)options
+                                                                   progress:(SealdBulkProgressHandler _Nullable)progress
+                                                                      error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
+
+/**
+ * Add many members to a group, in chunks of `options.chunkSize` members sent in parallel.
+ * Use this instead of SealdSdk.addGroupMembersWithGroupId:membersToAdd:adminsToSet:privateKeys:error: for large member lists,
+ * which would otherwise be sent in a single request that may time out.
+ * Chunks that fail with a network or server error are retried up to `options.retries` times; other errors are not retried.
+ * A failed attempt may still have been partly applied by the server: if a retry fails too, all members of the chunk get the error of the retry,
+ * even those already added, so check the members of the group before sending them again.
+ * Chunks that still fail do not prevent other chunks from being added.
+ * Can only be done by a group administrator.
+ *
+ * @param groupId The group in which to add members.
+ * @param membersToAdd The Seald IDs of the members to add to the group.
+ * @param adminsToSet The Seald IDs of the newly added members to also set as group admins.
+ * @param privateKeys Optional. Pre-generated private keys, returned by a call to SealdSdk.generatePrivateKeysWithError:.
+ * @param options Options for this operation. If `nil`, default options are used.
+ * @param progress A callback called after each chunk with the number of members processed so far, or `nil`.
+ * @param completionHandler A callback called after function execution. This callback takes two arguments, a `NSDictionary<NSString*, SealdActionStatus*>*` with the status of each member, and a `NSError*` that indicates if any error occurred before any member was added.
+ */
+- (void) addGroupMembersAsyncWithGroupId:(const NSString*)groupId
+                            membersToAdd:(const NSArray<NSString*>*)membersToAdd
+                             adminsToSet:(const NSArray<NSString*>*)adminsToSet
+                             privateKeys:(nullable SealdGeneratedPrivateKeys*)privateKeys
+                                 options:(const SealdGroupMembersOptions*_Nullable)options
+                                progress:(SealdBulkProgressHandler _Nullable)progress
+                       completionHandler:(void (^)(NSDictionary<NSString*, SealdActionStatus*>* result, NSError*_Nullable error))completionHandler;
+
+/**
+ * Remove many members from a group, in chunks of `options.chunkSize` members sent in parallel.
+ * Chunks that fail with a network or server error are retried up to `options.retries` times; other errors are not retried.
+ * A failed attempt may still have been partly applied by the server: if a retry fails too, all members of the chunk get the error of the retry,
+ * even those already removed, so check the members of the group before sending them again.
+ * Chunks that still fail do not prevent other chunks from being removed.
+ * Can only be done by a group administrator.
+ * You should call SealdSdk.renewGroupKeyWithGroupId:error: after this.
+ *
+ * @param groupId The group from which to remove members.
+ * @param membersToRemove The Seald IDs of the members to remove from the group.
+ * @param privateKeys Optional. Pre-generated private keys, returned by a call to SealdSdk.generatePrivateKeysWithError:.
+ * @param options Options for this operation. If `nil`, default options are used.
+ * @param progress A callback called after each chunk with the number of members processed so far, or `nil`.
+ * @param error If an error occurs before any member is removed, upon return contains an `NSError` object that describes the problem.
+ * @return A dictionary with the status of each member.
+ */
+- (NSDictionary<NSString*, SealdActionStatus*>*) removeGroupMembersWithGroupId:(const NSString*)groupId
+                                                               membersToRemove:(const NSArray<NSString*>*)membersToRemove
+                                                                   privateKeys:(nullable SealdGeneratedPrivateKeys*)privateKeys
+                                                                       options:(const SealdGroupMembersOptions*_Nullable)options
+                                                                      progress:(SealdBulkProgressHandler _Nullable)progress
+                                                                         error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
+
+/**
+ * Remove many members from a group, in chunks of `options.chunkSize` members sent in parallel.
+ * Chunks that fail with a network or server error are retried up to `options.retries` times; other errors are not retried.
+ * A failed attempt may still have been partly applied by the server: if a retry fails too, all members of the chunk get the error of the retry,
+ * even those already removed, so check the members of the group before sending them again.
+ * Chunks that still fail do not prevent other chunks from being removed.
+ * Can only be done by a group administrator.
+ * You should call SealdSdk.renewGroupKeyWithGroupId:error: after this.
+ *
+ * @param groupId The group from which to remove members.
+ * @param membersToRemove The Seald IDs of the members to remove from the group.
+ * @param privateKeys Optional. Pre-generated private keys, returned by a call to SealdSdk.generatePrivateKeysWithError:.
+ * @param options Options for this operation. If `nil`, default options are used.
+ * @param progress A callback called after each chunk with the number of members processed so far, or `nil`.
+ * @param completionHandler A callback called after function execution. This callback takes two arguments, a `NSDictionary<NSString*, SealdActionStatus*>*` with the status of each member, and a `NSError*` that indicates if any error occurred before any member was removed.
+ */
+- (void) removeGroupMembersAsyncWithGroupId:(const NSString*)groupId
+                            membersToRemove:(const NSArray<NSString*>*)membersToRemove
+                                privateKeys:(nullable SealdGeneratedPrivateKeys*)privateKeys
+                                    options:(const SealdGroupMembersOptions*_Nullable)options
+                                   progress:(SealdBulkProgressHandler _Nullable)progress
+                          completionHandler:(void (^)(NSDictionary<NSString*, SealdActionStatus*>* result, NSError*_Nullable error))completionHandler;
+
 /**
  * Renew the group's private key.
  * Can only be done by a group administrator.
@@ -439,6 +640,77 @@ FOUNDATION_EXPORT NSString*_Nonnull SealdSdkVersion;
                            privateKeys:(nullable SealdGeneratedPrivateKeys*)privateKeys
                      completionHandler:(void (^)(NSError*_Nullable error))completionHandler;
 
+/**
+ * Check whether the group's private key should be renewed, for example because members were removed since it was last renewed.
+ * Can only be done by a group administrator.
+ *
+ * @param groupId The group to check.
+ * @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ * @return `YES` if the key of the group should be renewed.
+ */
+- (BOOL) shouldRenewGroupWithGroupId:(const NSString*)groupId
+                               error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
+
+/**
+ * Check, in parallel, which of the given groups should have their private key renewed.
+ * Can only be done by a group administrator.
+ *
+ * @param groupIds The groups to check.
+ * @return A SealdGroupKeyRenewalReport in which `renewed` is empty.
+ */
+- (SealdGroupKeyRenewalReport*) shouldRenewGroups:(const NSArray<NSString*>*)groupIds;
+
+/**
+ * Check, in parallel, which of the given groups should have their private key renewed.
+ * Can only be done by a group administrator.
+ *
+ * @param groupIds The groups to check.
+ * @param completionHandler A callback called after function execution. This callback takes one argument, a SealdGroupKeyRenewalReport in which `renewed` is empty.
+ */
+- (void) shouldRenewGroupsAsync:(const NSArray<NSString*>*)groupIds
+              completionHandler:(void (^)(SealdGroupKeyRenewalReport* result))completionHandler;
+
+/**
+ * Renew the private key of each of the given groups that should be renewed, and only those.
+ * Keys are generated one group ahead, so that each renewal does not wait for key generation.
+ * Can only be done by a group administrator.
+ *
+ * @param groupIds The groups to check, and renew if needed.
+ * @return A SealdGroupKeyRenewalReport.
+ */
+- (SealdGroupKeyRenewalReport*) renewGroupKeysIfNeeded:(const NSArray<NSString*>*)groupIds;
+
+/**
+ * Renew the private key of each of the given groups that should be renewed, and only those.
+ * Keys are generated one group ahead, so that each renewal does not wait for key generation.
+ * Can only be done by a group administrator.
+ *
+ * @param groupIds The groups to check, and renew if needed.
+ * @param completionHandler A callback called after function execution. This callback takes one argument, a SealdGroupKeyRenewalReport.
+ */
+- (void) renewGroupKeysIfNeededAsync:(const NSArray<NSString*>*)groupIds
+                   completionHandler:(void (^)(SealdGroupKeyRenewalReport* result))completionHandler;
+
+/**
+ * Start renewing, every `interval`, the private keys of the given groups that should be renewed, at background priority,
+ * as with SealdSdk.renewGroupKeysIfNeeded:. A spare set of private keys is kept pre-generated between passes.
+ * Calling this again replaces the previous schedule. The schedule is stopped by SealdSdk.closeWithError:.
+ *
+ * @param groupIds The groups to check, and renew if needed.
+ * @param interval The time between the start of two passes. Must be greater than `0`. The first pass starts immediately.
+ * @param onPass A callback called after each pass with its report, or `nil`.
+ * @param error If `interval` is not greater than `0`, upon return contains an `NSError` object that describes the problem, and no renewal is started.
+ */
+- (void) startGroupKeyRenewalWithGroupIds:(const NSArray<NSString*>*)groupIds
+                                 interval:(NSTimeInterval)interval
+                                   onPass:(void (^_Nullable)(SealdGroupKeyRenewalReport* report))onPass
+                                    error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
+
+/**
+ * Stop the renewal started by SealdSdk.startGroupKeyRenewalWithGroupIds:interval:onPass:error:. A pass in progress is finished.
+ */
+- (void) stopGroupKeyRenewal;
+
 /**
  * Add some existing group members to the group admins, and/or removes admin status from some existing group admins.
  * Can only be done by a group administrator.
@@ -474,6 +746,7 @@ FOUNDATION_EXPORT NSString*_Nonnull SealdSdkVersion;
  * with which you can then encrypt / decrypt multiple messages.
  * Warning : if you want to be able to retrieve the session later,
  * you must put your own UserId in the `recipients` argument.
+ * If a pool is registered for these recipients and metadata, a pooled session is returned when available.
  *
  * @param recipients The Seald IDs with the associated rights of users who should be able to retrieve this session.
  * @param metadata Arbitrary metadata string, not encrypted, for later reference. Max 1024 characters long.
@@ -502,6 +775,182 @@ FOUNDATION_EXPORT NSString*_Nonnull SealdSdkVersion;
                                            useCache:(const BOOL)useCache
                                   completionHandler:(void (^)(SealdEncryptionSession* encryptionSession, NSError*_Nullable error))completionHandler;
 
+/**
+ * Create multiple encryption sessions, one per recipient set, and returns them in the same order as `recipientSets`.
+ * Sessions are created concurrently, which is much faster than calling createEncryptionSessionWithRecipients:metadata:useCache:error: in a loop.
+ * If any creation fails, the first error is returned.
+ *
+ * @param recipientSets For each session to create, the Seald IDs with the associated rights of users who should be able to retrieve it.
+ * @param metadata Arbitrary metadata string, not encrypted, for later reference, set on all sessions. Max 1024 characters long.
+ * @param useCache Whether or not to use the cache (if enabled globally).
+ * @param error The error that occurred while creating the sessions, if any.
+ * @return The created SealdEncryptionSession instances, in the order of `recipientSets`, or null if an error occurred.
+ */
+- (NSArray<SealdEncryptionSession*>*) createEncryptionSessionsWithRecipientSets:(const NSArray<NSArray<SealdRecipientWithRights*>*>*)recipientSets
+                                                                      metadata:(const NSString*_Nullable)metadata
+                                                                      useCache:(const BOOL)useCache
+                                                                         error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
+
+/**
+ * Create multiple encryption sessions, one per recipient set, and returns them in the same order as `recipientSets`.
+ * Sessions are created concurrently, which is much faster than calling createEncryptionSessionWithRecipients:metadata:useCache:error: in a loop.
+ * If any creation fails, the first error is returned.
+ *
+ * @param recipientSets For each session to create, the Seald IDs with the associated rights of users who should be able to retrieve it.
+ * @param metadata Arbitrary metadata string, not encrypted, for later reference, set on all sessions. Max 1024 characters long.
+ * @param useCache Whether or not to use the cache (if enabled globally).
+ * @param completionHandler A callback called after function execution. This callback takes two arguments, a `NSArray<SealdEncryptionSession*>*` containing the created encryption sessions, and a `NSError*` that indicates if any error occurred.
+ */
+- (void) createEncryptionSessionsAsyncWithRecipientSets:(const NSArray<NSArray<SealdRecipientWithRights*>*>*)recipientSets
+                                              metadata:(const NSString*_Nullable)metadata
+                                              useCache:(const BOOL)useCache
+                                     completionHandler:(void (^)(NSArray<SealdEncryptionSession*>* encryptionSessions, NSError*_Nullable error))completionHandler;
+
+/**
+ * Keep a pool of ready-made encryption sessions for a recipient set, refilled in the background.
+ * Afterwards, createEncryptionSessionWithRecipients:metadata:useCache:error: with the same recipients
+ * (in any order), rights and metadata, and with `useCache` set to `YES`, returns a pooled session instantly when one is available.
+ * Pooled sessions are created with `useCache` set to `YES`: calls with `useCache` set to `NO` always create a new session.
+ * Registering the same recipient set again replaces its pool.
+ *
+ * @param recipients The Seald IDs with the associated rights of users who should be able to retrieve the pooled sessions.
+ * @param metadata Arbitrary metadata string, not encrypted, for later reference. Max 1024 characters long.
+ * @param size The number of sessions to keep ready.
+ * @param maxAge How long an unused pooled session may be kept before being discarded. `0` to keep them indefinitely.
+ * @param onRefillError An optional callback, called on a background queue when a session cannot be created to refill the pool. The refill then stops until the next pooled session is taken.
+ */
+- (void) registerEncryptionSessionPoolWithRecipients:(const NSArray<SealdRecipientWithRights*>*)recipients
+                                            metadata:(const NSString*_Nullable)metadata
+                                                size:(const NSInteger)size
+                                              maxAge:(const NSTimeInterval)maxAge
+                                       onRefillError:(void (^_Nullable)(NSError* error))onRefillError;
+
+/**
+ * Stop keeping a pool of ready-made encryption sessions for a recipient set, and discard its pooled sessions.
+ *
+ * @param recipients The recipients the pool was registered with.
+ * @param metadata The metadata the pool was registered with.
+ */
+- (void) unregisterEncryptionSessionPoolWithRecipients:(const NSArray<SealdRecipientWithRights*>*)recipients
+                                              metadata:(const NSString*_Nullable)metadata;
+
+/**
+ * Pin an encryption session, so that it is never evicted from the memory cache nor from the session store,
+ * does not expire from the memory cache unless a TTL was set for it, and is loaded on warm-up.
+ * Pins are kept across launches in the session store.
+ * The session is cached the next time it is retrieved with `useCache`, if it is not already.
+ *
+ * @param sessionId The ID of the session to pin.
+ * @return `NO` if SealdSdkOptions.pinnedSessionCacheMaxEntries sessions are already pinned.
+ */
+- (BOOL) pinEncryptionSessionWithId:(const NSString*)sessionId;
+
+/**
+ * Unpin an encryption session, so that it can be evicted again.
+ *
+ * @param sessionId The ID of the session to unpin.
+ */
+- (void) unpinEncryptionSessionWithId:(const NSString*)sessionId;
+
+/**
+ * Set how long an encryption session stays in the memory cache, overriding `encryptionSessionCacheTTL` for this session only.
+ * Applies whether the session is already cached or not. If it is, its lifetime is counted again from now.
+ *
+ * @param ttl The duration of cache lifetime for this session. `-1` to cache forever, `0` to not cache it.
+ * @param sessionId The ID of the session.
+ */
+- (void) setCacheTTL:(const NSTimeInterval)ttl
+forEncryptionSessionWithId:(const NSString*)sessionId;
+
+/**
+ * Revert an encryption session to the default cache lifetime, `encryptionSessionCacheTTL`, or none if it is pinned.
+ *
+ * @param sessionId The ID of the session.
+ */
+- (void) removeCacheTTLForEncryptionSessionWithId:(const NSString*)sessionId;
+
+/**
+ * Get a snapshot of the encryption session caches: hits and misses for each retrieval flow,
+ * number of entries in the memory cache and in the session store, size of the store, and evictions by reason.
+ * The entries of the cache of the native core are not included, only its hits, as reported by SealdEncryptionSessionRetrievalDetails.fromCache.
+ *
+ * @return A SealdCacheStats instance.
+ */
+- (SealdCacheStats*) getCacheStats;
+
+/**
+ * Reset the counters returned by getCacheStats. Entries are kept.
+ */
+- (void) resetCacheStats;
+
+/**
+ * List the sessions in the memory cache.
+ *
+ * @return A SealdCacheEntryInfo for each session in the memory cache. Empty if SealdSdkOptions.sessionCacheMaxEntries is `0`.
+ */
+- (NSArray<SealdCacheEntryInfo*>*) listCacheEntries;
+
+/**
+ * Remove sessions from the memory cache and from the session store. They will be retrieved again from the server the next time they are used.
+ *
+ * @param sessionIds The IDs of the sessions to remove.
+ */
+- (void) clearCacheForEncryptionSessionIds:(const NSArray<NSString*>*)sessionIds;
+
+/**
+ * Remove the sessions of the memory cache that match a predicate, for example all the sessions retrieved via a given group,
+ * from the memory cache and from the session store.
+ *
+ * @param predicate A block called on each entry of listCacheEntries, that returns `YES` if the session must be removed.
+ */
+- (void) clearCacheMatching:(BOOL (^)(SealdCacheEntryInfo* entry))predicate;
+
+/**
+ * Remove all sessions from the memory cache and from the session store.
+ */
+- (void) clearCache;
+
+/**
+ * Ask the server which cached sessions may not be accessible anymore, and remove them from the memory cache and from the session store.
+ * For each group via which cached sessions were retrieved, the last hash of its sigchain is compared to the one seen on the previous poll:
+ * if the group changed (members removed, key renewed, ...), its sessions are invalidated. These hashes are kept in the session store, if any,
+ * so that changes made while the app was not running are detected too. Then up to `options.revalidationBatchSize` sessions of the memory cache
+ * or the session store, created or retrieved directly, via a group or via a proxy, are retrieved again in one request,
+ * and those to which the server denies access are invalidated.
+ * Network errors do not invalidate anything, so that cached sessions stay usable offline.
+ * Sessions are already invalidated without polling when this instance revokes them, removes the current user from a group, or renews a group key.
+ *
+ * @param options The options of the poll. If `nil`, default options are used.
+ * @return The IDs of the invalidated sessions.
+ */
+- (NSArray<NSString*>*) pollCacheInvalidationsWithOptions:(const SealdCacheInvalidationOptions*_Nullable)options;
+
+/**
+ * Ask the server which cached sessions may not be accessible anymore, and remove them from the memory cache and from the session store.
+ *
+ * @param options The options of the poll. If `nil`, default options are used.
+ * @param completionHandler A callback called after function execution. This callback takes one argument, a `NSArray<NSString*>*` containing the IDs of the invalidated sessions.
+ */
+- (void) pollCacheInvalidationsAsyncWithOptions:(const SealdCacheInvalidationOptions*_Nullable)options
+                              completionHandler:(void (^)(NSArray<NSString*>* invalidatedSessionIds))completionHandler;
+
+/**
+ * Start polling for cache invalidations every `options.pollInterval` on a background queue, with SealdSdk.pollCacheInvalidationsWithOptions:,
+ * so that long cache TTLs can be used safely. Calling it again replaces the previous poll. The poll is stopped by SealdSdk.closeWithError:.
+ *
+ * @param options The options of the poll. If `nil`, default options are used.
+ * @param onPass An optional callback called after each poll with the IDs of the invalidated sessions, on a background queue.
+ * @param error If `options.pollInterval` is not greater than `0`, upon return contains an `NSError` object that describes the problem, and no poll is started.
+ */
+- (void) startCacheInvalidationPollWithOptions:(const SealdCacheInvalidationOptions*_Nullable)options
+                                        onPass:(void (^_Nullable)(NSArray<NSString*>* invalidatedSessionIds))onPass
+                                         error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
+
+/**
+ * Stop the poll started by SealdSdk.startCacheInvalidationPollWithOptions:onPass:error:.
+ */
+- (void) stopCacheInvalidationPoll;
+
 /**
  * Retrieve an encryption session with the `sessionId`, and returns the associated
  * SealdEncryptionSession instance, with which you can then encrypt / decrypt multiple messages.
@@ -719,6 +1168,200 @@ FOUNDATION_EXPORT NSString*_Nonnull SealdSdkVersion;
 - (SealdEncryptionSession*) deserializeEncryptionSession:(const NSString*_Nonnull)serializedSession
                                                    error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
 
+// Bulk
+/**
+ * Add recipients to many existing sessions, for example when a new member joins a team.
+ * Sessions are retrieved in batches of `options.batchSize`, and at most `options.maxConcurrency` sessions are updated at the same time.
+ * A failure on one session does not stop the operation: it is reported in the returned statuses.
+ *
+ * @param recipients The Seald IDs with the associated rights of users to add to the sessions.
+ * @param sessionIds The IDs of the sessions to which to add recipients.
+ * @param options Options for this operation. If `nil`, default options are used.
+ * @param progress A callback called after each session with the number of sessions processed so far, or `nil`.
+ * @return A dictionary with, for each session ID, a SealdActionStatus that succeeded if all recipients were added.
+ */
+- (NSDictionary<NSString*, SealdActionStatus*>*) addRecipients:(const NSArray<SealdRecipientWithRights*>*)recipients
+                                                  toSessionIds:(const NSArray<NSString*>*)sessionIds
+                                                       options:(const SealdBulkOptions*_Nullable)options
+                                                      progress:(SealdBulkProgressHandler _Nullable)progress;
+
+/**
+ * Add recipients to many existing sessions, for example when a new member joins a team.
+ * Sessions are retrieved in batches of `options.batchSize`, and at most `options.maxConcurrency` sessions are updated at the same time.
+ * A failure on one session does not stop the operation: it is reported in the returned statuses.
+ *
+ * @param recipients The Seald IDs with the associated rights of users to add to the sessions.
+ * @param sessionIds The IDs of the sessions to which to add recipients.
+ * @param options Options for this operation. If `nil`, default options are used.
+ * @param progress A callback called after each session with the number of sessions processed so far, or `nil`.
+ * @param completionHandler A callback called after function execution. This callback takes one argument, a `NSDictionary<NSString*, SealdActionStatus*>*` with the status of each session.
+ */
+- (void) addRecipientsAsync:(const NSArray<SealdRecipientWithRights*>*)recipients
+               toSessionIds:(const NSArray<NSString*>*)sessionIds
+                    options:(const SealdBulkOptions*_Nullable)options
+                   progress:(SealdBulkProgressHandler _Nullable)progress
+          completionHandler:(void (^)(NSDictionary<NSString*, SealdActionStatus*>* result))completionHandler;
+
+/**
+ * Add a proxy session as a recipient of many existing sessions, for example to share all the documents of a folder.
+ * Sessions are retrieved in batches of `options.batchSize`, and at most `options.maxConcurrency` sessions are updated at the same time.
+ * A failure on one session does not stop the operation: it is reported in the returned statuses.
+ *
+ * @param proxySessionId The ID of the session to add as proxy.
+ * @param rights The rights to assign to this proxy, or `nil` for default rights.
+ * @param sessionIds The IDs of the sessions to which to add the proxy session.
+ * @param options Options for this operation. If `nil`, default options are used.
+ * @param progress A callback called after each session with the number of sessions processed so far, or `nil`.
+ * @return A dictionary with, for each session ID, a SealdActionStatus that indicates if the proxy session was added.
+ */
+- (NSDictionary<NSString*, SealdActionStatus*>*) addProxySession:(const NSString*)proxySessionId
+                                                           rights:(const SealdRecipientRights*_Nullable)rights
+                                                     toSessionIds:(const NSArray<NSString*>*)sessionIds
+                                                          options:(const SealdBulkOptions*_Nullable)options
+                                                         progress:(SealdBulkProgressHandler _Nullable)progress;
+
+/**
+ * Add a proxy session as a recipient of many existing sessions, for example to share all the documents of a folder.
+ * Sessions are retrieved in batches of `options.batchSize`, and at most `options.maxConcurrency` sessions are updated at the same time.
+ * A failure on one session does not stop the operation: it is reported in the returned statuses.
+ *
+ * @param proxySessionId The ID of the session to add as proxy.
+ * @param rights The rights to assign to this proxy, or `nil` for default rights.
+ * @param sessionIds The IDs of the sessions to which to add the proxy session.
+ * @param options Options for this operation. If `nil`, default options are used.
+ * @param progress A callback called after each session with the number of sessions processed so far, or `nil`.
+ * @param completionHandler A callback called after function execution. This callback takes one argument, a `NSDictionary<NSString*, SealdActionStatus*>*` with the status of each session.
+ */
+- (void) addProxySessionAsync:(const NSString*)proxySessionId
+                       rights:(const SealdRecipientRights*_Nullable)rights
+                 toSessionIds:(const NSArray<NSString*>*)sessionIds
+                      options:(const SealdBulkOptions*_Nullable)options
+                     progress:(SealdBulkProgressHandler _Nullable)progress
+            completionHandler:(void (^)(NSDictionary<NSString*, SealdActionStatus*>* result))completionHandler;
+
+/**
+ * Add TMR accesses for the same recipients to many existing sessions, for example to onboard an external reviewer on many documents.
+ * Sessions are retrieved in batches of `options.batchSize`, and at most `options.maxConcurrency` sessions are updated at the same time.
+ * A failure on one session does not stop the operation: it is reported in the returned result.
+ *
+ * @param recipients The TMR recipients with their associated rights.
+ * @param sessionIds The IDs of the sessions to which to add TMR accesses.
+ * @param options Options for this operation. If `nil`, default options are used.
+ * @param progress A callback called after each session with the number of sessions processed so far, or `nil`.
+ * @param error The error that occurred while preparing the recipients, if any.
+ * @return A SealdBulkTmrAccessesResult with per-session and per-recipient statuses.
+ */
+- (SealdBulkTmrAccessesResult*) addMultipleTmrAccesses:(const NSArray<SealdTmrRecipientWithRights*>*)recipients
+                                          toSessionIds:(const NSArray<NSString*>*)sessionIds
+                                               options:(const SealdBulkOptions*_Nullable)options
+                                              progress:(SealdBulkProgressHandler _Nullable)progress
+                                                 error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
+
+/**
+ * Add TMR accesses for the same recipients to many existing sessions, for example to onboard an external reviewer on many documents.
+ * Sessions are retrieved in batches of `options.batchSize`, and at most `options.maxConcurrency` sessions are updated at the same time.
+ * A failure on one session does not stop the operation: it is reported in the returned result.
+ *
+ * @param recipients The TMR recipients with their associated rights.
+ * @param sessionIds The IDs of the sessions to which to add TMR accesses.
+ * @param options Options for this operation. If `nil`, default options are used.
+ * @param progress A callback called after each session with the number of sessions processed so far, or `nil`.
+ * @param completionHandler A callback called after function execution. This callback takes two arguments, a `SealdBulkTmrAccessesResult*` with per-session and per-recipient statuses, and a `NSError*` that indicates if any error occurred.
+ */
+- (void) addMultipleTmrAccessesAsync:(const NSArray<SealdTmrRecipientWithRights*>*)recipients
+                        toSessionIds:(const NSArray<NSString*>*)sessionIds
+                             options:(const SealdBulkOptions*_Nullable)options
+                            progress:(SealdBulkProgressHandler _Nullable)progress
+                   completionHandler:(void (^)(SealdBulkTmrAccessesResult* result, NSError*_Nullable error))completionHandler;
+
+/**
+ * Make the Seald recipients of many existing sessions exactly `sealdIds`, as with SealdEncryptionSession.setRecipients:rights:error:.
+ * The current user is never revoked, even if it is not in `sealdIds`, and keeps its current rights.
+ * Sessions are retrieved in batches of `options.batchSize`, and at most `options.maxConcurrency` sessions are updated at the same time.
+ *
+ * @param sealdIds The Seald IDs of users and groups that should be the recipients of the sessions.
+ * @param rights The rights the recipients should have, or `nil` for default rights.
+ * @param sessionIds The IDs of the sessions to update.
+ * @param options Options for this operation. If `nil`, default options are used.
+ * @param progress A callback called after each session with the number of sessions processed so far, or `nil`.
+ * @return A dictionary with, for each session ID, a SealdActionStatus that succeeded if all changes were applied.
+ */
+- (NSDictionary<NSString*, SealdActionStatus*>*) setRecipients:(const NSArray<NSString*>*)sealdIds
+                                                        rights:(const SealdRecipientRights*_Nullable)rights
+                                                 forSessionIds:(const NSArray<NSString*>*)sessionIds
+                                                       options:(const SealdBulkOptions*_Nullable)options
+                                                      progress:(SealdBulkProgressHandler _Nullable)progress;
+
+/**
+ * Make the Seald recipients of many existing sessions exactly `sealdIds`, as with SealdEncryptionSession.setRecipients:rights:error:.
+ * The current user is never revoked, even if it is not in `sealdIds`, and keeps its current rights.
+ * Sessions are retrieved in batches of `options.batchSize`, and at most `options.maxConcurrency` sessions are updated at the same time.
+ *
+ * @param sealdIds The Seald IDs of users and groups that should be the recipients of the sessions.
+ * @param rights The rights the recipients should have, or `nil` for default rights.
+ * @param sessionIds The IDs of the sessions to update.
+ * @param options Options for this operation. If `nil`, default options are used.
+ * @param progress A callback called after each session with the number of sessions processed so far, or `nil`.
+ * @param completionHandler A callback called after function execution. This callback takes one argument, a `NSDictionary<NSString*, SealdActionStatus*>*` with the status of each session.
+ */
+- (void) setRecipientsAsync:(const NSArray<NSString*>*)sealdIds
+                     rights:(const SealdRecipientRights*_Nullable)rights
+              forSessionIds:(const NSArray<NSString*>*)sessionIds
+                    options:(const SealdBulkOptions*_Nullable)options
+                   progress:(SealdBulkProgressHandler _Nullable)progress
+          completionHandler:(void (^)(NSDictionary<NSString*, SealdActionStatus*>* result))completionHandler;
+
+/**
+ * Revoke recipients from many existing sessions, for example when offboarding a user.
+ * Sessions are retrieved in batches of `options.batchSize`, and at most `options.maxConcurrency` sessions are updated at the same time.
+ * If `checkpointPath` is set, the results are saved there after each batch: calling this function again with the same
+ * checkpoint path skips the sessions that are already done, so an operation interrupted by the app being killed can be resumed.
+ * The checkpoint also stores `sealdIds`, `proxySessionsIds` and `sessionIds`: resuming from it with different ones fails with `CHECKPOINT_MISMATCH`.
+ * If saving the checkpoint fails, the operation stops at the end of the current batch and returns the error.
+ * The checkpoint file is deleted once all sessions have been revoked successfully.
+ *
+ * @param sealdIds The Seald IDs of users to revoke from the sessions.
+ * @param proxySessionsIds The IDs of proxy sessions to revoke from the sessions.
+ * @param sessionIds The IDs of the sessions from which to revoke recipients.
+ * @param options Options for this operation. If `nil`, default options are used.
+ * @param checkpointPath The path of a file in which to save progress, or `nil`.
+ * @param progress A callback called after each session with the number of sessions processed so far, or `nil`.
+ * @param error The error that occurred while reading, matching or writing the checkpoint, if any.
+ * @return A SealdBulkRevokeResult with the result for each session.
+ */
+- (SealdBulkRevokeResult*) revokeRecipientsWithSealdIds:(const NSArray<NSString*>*_Nullable)sealdIds
+                                       proxySessionsIds:(const NSArray<NSString*>*_Nullable)proxySessionsIds
+                                         fromSessionIds:(const NSArray<NSString*>*)sessionIds
+                                                options:(const SealdBulkOptions*_Nullable)options
+                                         checkpointPath:(const NSString*_Nullable)checkpointPath
+                                               progress:(SealdBulkProgressHandler _Nullable)progress
+                                                  error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
+
+/**
+ * Revoke recipients from many existing sessions, for example when offboarding a user.
+ * Sessions are retrieved in batches of `options.batchSize`, and at most `options.maxConcurrency` sessions are updated at the same time.
+ * If `checkpointPath` is set, the results are saved there after each batch: calling this function again with the same
+ * checkpoint path skips the sessions that are already done, so an operation interrupted by the app being killed can be resumed.
+ * The checkpoint also stores `sealdIds`, `proxySessionsIds` and `sessionIds`: resuming from it with different ones fails with `CHECKPOINT_MISMATCH`.
+ * If saving the checkpoint fails, the operation stops at the end of the current batch and returns the error.
+ * The checkpoint file is deleted once all sessions have been revoked successfully.
+ *
+ * @param sealdIds The Seald IDs of users to revoke from the sessions.
+ * @param proxySessionsIds The IDs of proxy sessions to revoke from the sessions.
+ * @param sessionIds The IDs of the sessions from which to revoke recipients.
+ * @param options Options for this operation. If `nil`, default options are used.
+ * @param checkpointPath The path of a file in which to save progress, or `nil`.
+ * @param progress A callback called after each session with the number of sessions processed so far, or `nil`.
+ * @param completionHandler A callback called after function execution. This callback takes two arguments, a `SealdBulkRevokeResult*` with the result for each session, and a `NSError*` that indicates if any error occurred.
+ */
+- (void) revokeRecipientsAsyncWithSealdIds:(const NSArray<NSString*>*_Nullable)sealdIds
+                          proxySessionsIds:(const NSArray<NSString*>*_Nullable)proxySessionsIds
+                            fromSessionIds:(const NSArray<NSString*>*)sessionIds
+                                   options:(const SealdBulkOptions*_Nullable)options
+                            checkpointPath:(const NSString*_Nullable)checkpointPath
+                                  progress:(SealdBulkProgressHandler _Nullable)progress
+                         completionHandler:(void (^)(SealdBulkRevokeResult* result, NSError*_Nullable error))completionHandler;
+
 // Connectors
 /**
  * Get all the info for the given connectors to look for, updates the local cache of connectors,
@@ -764,6 +1407,71 @@ FOUNDATION_EXPORT NSString*_Nonnull SealdSdkVersion;
 - (void) getConnectorsAsyncFromSealdId:(const NSString*)sealdId
                      completionHandler:(void (^)(NSArray<SealdConnector*>* connectors, NSError*_Nullable error))completionHandler __attribute__((swift_async_name("getConnectorsAsyncFromSealdId(sealdId:)")));
 
+/**
+ * Get the Seald IDs corresponding to the given connectors, like SealdSdk.getSealdIdsFromConnectors:error:, using the connectors cache
+ * configured with SealdSdkOptions.connectorsCacheTTL. Connectors that are not cached are looked up in a single request.
+ * If that request fails because some connectors are not assigned to a Seald user, each of them is looked up separately,
+ * so that the known ones are cached and the unknown ones are remembered for SealdSdkOptions.connectorsNegativeCacheTTL.
+ * If one of the connectors is not assigned to a Seald user, this returns the same ErrorGetSealdIdsUnknownConnector error as SealdSdk.getSealdIdsFromConnectors:error:.
+ *
+ * @param connectorTypeValues An Array of ConnectorTypeValue instances.
+ * @param useCache Whether to use the connectors cache. If `NO`, or if the cache is disabled, this is the same as SealdSdk.getSealdIdsFromConnectors:error:.
+ * @param error The error that occurred while getting the Seald IDs, if any.
+ * @return An Array of NSString with the Seald IDs of the users corresponding to these connectors, in the same order.
+ */
+- (NSArray<NSString*>*) getSealdIdsFromConnectors:(const NSArray<SealdConnectorTypeValue*>*)connectorTypeValues
+                                         useCache:(const BOOL)useCache
+                                            error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
+
+/**
+ * Get the Seald IDs corresponding to the given connectors, using the connectors cache configured with SealdSdkOptions.connectorsCacheTTL.
+ *
+ * @param connectorTypeValues An Array of ConnectorTypeValue instances.
+ * @param useCache Whether to use the connectors cache.
+ * @param completionHandler A callback called after function execution. This callback takes two arguments, an Array of NSString with the Seald IDs of the users corresponding to these connectors, and a `NSError*` that indicates if any error occurred.
+ */
+- (void) getSealdIdsAsyncFromConnectors:(const NSArray<SealdConnectorTypeValue*>*)connectorTypeValues
+                               useCache:(const BOOL)useCache
+                      completionHandler:(void (^)(NSArray<NSString*>* sealdIds, NSError*_Nullable error))completionHandler;
+
+/**
+ * List the connectors of a Seald ID, like SealdSdk.getConnectorsFromSealdId:error:, using the connectors cache
+ * configured with SealdSdkOptions.connectorsCacheTTL.
+ *
+ * @param sealdId The Seald ID for which to list connectors
+ * @param useCache Whether to use the connectors cache. If `NO`, or if the cache is disabled, this is the same as SealdSdk.getConnectorsFromSealdId:error:.
+ * @param error The error that occurred while listing the connectors, if any.
+ * @return An Array of Connector instances.
+ */
+- (NSArray<SealdConnector*>*) getConnectorsFromSealdId:(const NSString*)sealdId
+                                              useCache:(const BOOL)useCache
+                                                 error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
+
+/**
+ * List the connectors of a Seald ID, using the connectors cache configured with SealdSdkOptions.connectorsCacheTTL.
+ *
+ * @param sealdId The Seald ID for which to list connectors
+ * @param useCache Whether to use the connectors cache.
+ * @param completionHandler A callback called after function execution. This callback takes two arguments, an `NSArray` of SealdConnector* instances, and a `NSError*` that indicates if any error occurred.
+ */
+- (void) getConnectorsAsyncFromSealdId:(const NSString*)sealdId
+                              useCache:(const BOOL)useCache
+                     completionHandler:(void (^)(NSArray<SealdConnector*>* connectors, NSError*_Nullable error))completionHandler;
+
+/**
+ * Fill the connectors cache with already known connectors, for example the result of SealdSdk.listConnectorsWithError:,
+ * or connectors received from your own server. The connectors given for a Seald ID are considered to be all of its connectors.
+ * Does nothing if the connectors cache is disabled.
+ *
+ * @param connectors The connectors to cache.
+ */
+- (void) seedConnectorsCacheWithConnectors:(const NSArray<SealdConnector*>*)connectors;
+
+/**
+ * Empty the connectors cache.
+ */
+- (void) clearConnectorsCache;
+
 /**
  * Add a connector to the current identity.
  * If no preValidationToken is given, the connector will need to be validated before use.
@@ -892,6 +1600,29 @@ FOUNDATION_EXPORT NSString*_Nonnull SealdSdkVersion;
                                 options:(const SealdMassReencryptOptions*)options
                       completionHandler:(void (^)(SealdMassReencryptResponse* response, NSError*_Nullable error))completionHandler;
 
+/**
+ * Retrieve, re-encrypt, and add missing keys for several devices, re-encrypting up to `options.concurrency` devices at the same time,
+ * so that network transfers and cryptographic operations for different devices overlap.
+ *
+ * @param deviceIds The IDs of the devices for which to re-rencrypt.
+ * @param options A SealdMassReencryptOptions instance, or `nil` to use default options.
+ * @return A SealdMassReencryptDevicesResult instance, with the result of each device.
+ */
+- (SealdMassReencryptDevicesResult*) massReencryptWithDeviceIds:(const NSArray<NSString*>*)deviceIds
+                                                        options:(const SealdMassReencryptOptions*_Nullable)options;
+
+/**
+ * Retrieve, re-encrypt, and add missing keys for several devices, re-encrypting up to `options.concurrency` devices at the same time,
+ * so that network transfers and cryptographic operations for different devices overlap.
+ *
+ * @param deviceIds The IDs of the devices for which to re-rencrypt.
+ * @param options A SealdMassReencryptOptions instance, or `nil` to use default options.
+ * @param completionHandler A callback called after function execution. This callback takes one argument, a SealdMassReencryptDevicesResult instance.
+ */
+- (void) massReencryptAsyncWithDeviceIds:(const NSArray<NSString*>*)deviceIds
+                                 options:(const SealdMassReencryptOptions*_Nullable)options
+                       completionHandler:(void (^)(SealdMassReencryptDevicesResult* result))completionHandler;
+
 /**
  * List which of the devices of the current account are missing keys,
  * so you can call SealdSdk.massReencryptWithDeviceId:options:error: for them.
@@ -912,6 +1643,30 @@ FOUNDATION_EXPORT NSString*_Nonnull SealdSdkVersion;
  */
 - (void) devicesMissingKeysAsyncWithForceLocalAccountUpdate:(const BOOL)forceLocalAccountUpdate
                                           completionHandler:(void (^)(NSArray<SealdDeviceMissingKeys*>* devices, NSError*_Nullable error))completionHandler;
+
+/**
+ * Start a background service that periodically checks for devices of the current account that are missing keys,
+ * for example a newly added device, and re-encrypts keys for them, so that they can read history without any action from the app.
+ * When several devices of the account run this service, each of them waits a different delay, derived from its own device ID and
+ * the ID of the device to provision, then checks again: usually a single device does the re-encryption, and the others find nothing left to do.
+ * Re-encryptions run at background priority, one at a time, and spaced by `options.minTimeBetweenReencryptions`. Waiting does not hold a thread.
+ * The local account is refreshed from the server on the first check only: later checks use the local account, which other calls keep up to date.
+ * Calling this again replaces the previous service. The service is stopped by SealdSdk.closeWithError:.
+ *
+ * @param options Options for this service, or `nil` to use default options.
+ * @param onDeviceProvisioned A callback called after each re-encryption, with the ID of the device, the response, and an `NSError*` if it failed, or `nil`.
+ * @param onPassError A callback called when a check cannot list the devices missing keys, with the error, or `nil`. The service keeps running, and the next check tries again.
+ * @param error If `options.pollInterval` is not greater than `0`, upon return contains an `NSError` object that describes the problem, and the service is not started.
+ */
+- (void) startKeyProvisioningWithOptions:(const SealdKeyProvisioningOptions*_Nullable)options
+                     onDeviceProvisioned:(void (^_Nullable)(NSString* deviceId, SealdMassReencryptResponse*_Nullable response, NSError*_Nullable error))onDeviceProvisioned
+                             onPassError:(void (^_Nullable)(NSError* error))onPassError
+                                   error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)));
+
+/**
+ * Stop the service started by SealdSdk.startKeyProvisioningWithOptions:onDeviceProvisioned:onPassError:error:. A re-encryption in progress is finished.
+ */
+- (void) stopKeyProvisioning;
 /**
  * Get a user's sigchain transaction hash at index `position`.
  *
@@ -15,6 +15,81 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
     SealdSdkVersion = SealdSdkInternalsMobile_sdkVersion;
 }
 
+// Maximum number of concurrent API calls made by functions that operate on many sessions at once.
+static const NSInteger defaultMaxConcurrency = 8;
+
+// FNV-1a hash of `string`, stable across processes and devices, unlike `-[NSString hash]`.
+static uint64_t stableHash(NSString* string)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const char* c = [string UTF8String]; *c != 0; c++) {
+        hash ^= (uint8_t)*c;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Whether `error` means that the server denies access to the session, as opposed to a network or server failure.
+static BOOL isAccessDeniedError(NSError* error)
+{
+    id status = error.userInfo[@"status"];
+    if (![status isKindOfClass:[NSNumber class]]) {
+        return NO;
+    }
+    NSInteger httpStatus = [status integerValue];
+    return httpStatus == 403 || httpStatus == 404 || httpStatus == 410;
+}
+
+// Whether `error` means that some of the connectors looked up are not assigned to any Seald user.
+static BOOL isUnknownConnectorError(NSError* error)
+{
+    id errorId = error.userInfo[@"id"];
+    return [errorId isKindOfClass:[NSString class]] && [errorId hasSuffix:@"UNKNOWN_CONNECTOR"];
+}
+
+// Whether `error` is worth retrying: a network failure, which has no HTTP status, a `429`, or a server error.
+static BOOL isTransientError(NSError* error)
+{
+    id status = error.userInfo[@"status"];
+    if (![status isKindOfClass:[NSNumber class]] || [status integerValue] == 0) {
+        return YES;
+    }
+    NSInteger httpStatus = [status integerValue];
+    return httpStatus == 429 || httpStatus >= 500;
+}
+
+// Runs `block` for each index in [0, count), with at most `maxConcurrency` blocks in flight, and waits for all of them.
+static void runConcurrently(NSInteger count, NSInteger maxConcurrency, void (^block)(NSInteger index))
+{
+    dispatch_group_t group = dispatch_group_create();
+    dispatch_semaphore_t slots = dispatch_semaphore_create(MAX(maxConcurrency, 1));
+    dispatch_queue_t queue = dispatch_get_global_queue(qos_class_self(), 0);
+    for (NSInteger i = 0; i < count; i++) {
+        dispatch_semaphore_wait(slots, DISPATCH_TIME_FOREVER);
+        dispatch_group_async(group, queue, ^{
+            block(i);
+            dispatch_semaphore_signal(slots);
+        });
+    }
+    dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+}
+
+@implementation SealdSdkOptions
+- (instancetype) init
+{
+    self = [super init];
+    if (self) {
+        _sessionStoreMaxEntries = 0;
+        _sessionCacheMaxEntries = 0;
+        _pinnedSessionCacheMaxEntries = 100;
+        _warmUpSessionCount = 0;
+        _connectorsCacheTTL = 0;
+        _connectorsNegativeCacheTTL = 60;
+    }
+    return self;
+}
+@end
+
 @implementation SealdSdk
 - (instancetype) initWithApiUrl:(const NSString*)apiUrl
                           appId:(const NSString*)appId
@@ -26,9 +101,51 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
       encryptionSessionCacheTTL:(const NSTimeInterval)encryptionSessionCacheTTL
                         keySize:(const NSInteger)keySize
                           error:(NSError*_Nullable*)error
+{
+    return [self initWithApiUrl:apiUrl
+                          appId:appId
+                   databasePath:databasePath
+          databaseEncryptionKey:databaseEncryptionKey
+                   instanceName:instanceName
+                       logLevel:logLevel
+                     logNoColor:logNoColor
+      encryptionSessionCacheTTL:encryptionSessionCacheTTL
+                        keySize:keySize
+                        options:nil
+                          error:error];
+}
+
+- (instancetype) initWithApiUrl:(const NSString*)apiUrl
+                          appId:(const NSString*)appId
+                   databasePath:(const NSString*_Nullable)databasePath
+          databaseEncryptionKey:(const NSData*_Nullable)databaseEncryptionKey
+                   instanceName:(const NSString*)instanceName
+                       logLevel:(const NSInteger)logLevel
+                     logNoColor:(const BOOL)logNoColor
+      encryptionSessionCacheTTL:(const NSTimeInterval)encryptionSessionCacheTTL
+                        keySize:(const NSInteger)keySize
+                        options:(SealdSdkOptions*_Nullable)options
+                          error:(NSError*_Nullable*)error
 {
     self = [super init];
     if (self) {
+        self->sdkOptions = options ?: [[SealdSdkOptions alloc] init];
+        cacheStats = [[SealdCacheStatsCollector alloc] init];
+        sessionStoreWrites = dispatch_group_create();
+        NSError* localErr = nil;
+
+        if (sdkOptions.sessionStoreMaxEntries > 0 && databasePath != nil && databaseEncryptionKey != nil) {
+            sessionStore = [[SealdSessionStore alloc] initWithDirectory:[(NSString*)databasePath stringByAppendingString:@"-sessions"]
+                                                          encryptionKey:(NSData*)databaseEncryptionKey
+                                                             maxEntries:sdkOptions.sessionStoreMaxEntries
+                                                                onError:sdkOptions.onSessionStoreError
+                                                                  error:&localErr];
+            if (localErr) {
+                if (error) *error = localErr;
+                return nil;
+            }
+        }
+
         SealdSdkInternalsMobile_sdkSdkInitializeOptions* initOpts = [[SealdSdkInternalsMobile_sdkSdkInitializeOptions alloc] init];
         initOpts.apiURL = (NSString*)apiUrl;
         initOpts.appId = (NSString*)appId;
@@ -41,13 +158,37 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
         initOpts.encryptionSessionCacheTTL = (int64_t)(encryptionSessionCacheTTL * 1000);
         initOpts.keySize = keySize == 0 ? 4096 : keySize;
 
-        NSError* localErr = nil;
         sdkInstance = SealdSdkInternalsMobile_sdkInitialize(initOpts, &localErr);
         if (localErr) {
             _SealdInternal_ConvertError(localErr, error);
             return nil;
         }
         self->keySize = keySize;
+        sessionCacheTTL = encryptionSessionCacheTTL;
+        sessionPools = [NSMutableDictionary dictionary];
+        // Hashes seen by previous launches, so that a group that changed while the app was not running is detected on the first poll.
+        groupSigchainHashes = [NSMutableDictionary dictionaryWithDictionary:[sessionStore groupSigchainHashes] ?: @{}];
+        revalidationDates = [NSMutableDictionary dictionary];
+        if (sdkOptions.connectorsCacheTTL > 0) {
+            connectorCache = [[SealdConnectorCache alloc] initWithTTL:sdkOptions.connectorsCacheTTL negativeTTL:sdkOptions.connectorsNegativeCacheTTL];
+        }
+
+        if (sdkOptions.sessionCacheMaxEntries > 0) {
+            sessionCache = [[SealdSessionCache alloc] initWithMaxEntries:sdkOptions.sessionCacheMaxEntries
+                                                        maxPinnedEntries:sdkOptions.pinnedSessionCacheMaxEntries
+                                                              defaultTTL:encryptionSessionCacheTTL];
+            for (NSString* sessionId in [sessionStore pinnedSessionIds]) {
+                [sessionCache setPinned:YES forSessionWithId:sessionId];
+            }
+            if (sdkOptions.warmUpSessionCount > 0 && sessionStore != nil) {
+                SealdCancellationToken* token = [[SealdCancellationToken alloc] init];
+                warmUpCancellationToken = token;
+                NSInteger count = sdkOptions.warmUpSessionCount;
+                dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+                    [self _warmUpSessionCacheWithCount:count cancellationToken:token];
+                });
+            }
+        }
     }
     return self;
 }
@@ -55,6 +196,19 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
 - (void) closeWithError:(NSError*_Nullable*)error
 {
     NSError* localErr = nil;
+    @synchronized (sessionPools) {
+        for (NSString* key in sessionPools) {
+            [sessionPools[key] drain];
+        }
+        [sessionPools removeAllObjects];
+    }
+    [self stopGroupKeyRenewal];
+    [self stopKeyProvisioning];
+    [self stopCacheInvalidationPoll];
+    [warmUpCancellationToken cancel];
+    [sessionCache removeAllSessions];
+    dispatch_group_wait(sessionStoreWrites, DISPATCH_TIME_FOREVER);
+    [sessionStore flushManifest];
     [sdkInstance close:&localErr];
     if (localErr) {
         _SealdInternal_ConvertError(localErr, error);
@@ -73,7 +227,12 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
 
 - (void) _generateRSAKey:(void (^)(NSData* keyRawData, NSError* error))completionHandler
 {
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    // Key generation is expensive: when called from background work, do not raise its priority.
+    qos_class_t qos = qos_class_self();
+    if (qos == QOS_CLASS_UNSPECIFIED || qos > QOS_CLASS_DEFAULT) {
+        qos = QOS_CLASS_DEFAULT;
+    }
+    dispatch_async(dispatch_get_global_queue(qos, 0), ^{
         NSError* error;
         NSDictionary* parameters = @{
             (__bridge id)kSecAttrKeyType: (__bridge id)kSecAttrKeyTypeRSA,
@@ -485,35 +644,49 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
 }
 
 
-- (void) addGroupMembersWithGroupId:(const NSString*)groupId
-                       membersToAdd:(const NSArray<NSString*>*)membersToAdd
-                        adminsToSet:(const NSArray<NSString*>*)adminsToSet
-                        privateKeys:(nullable SealdGeneratedPrivateKeys*)privateKeys
-                              error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)))
+// Renews the key of `groupId` if the API says it should be renewed before changing its members.
+// Returns `NO` if an error occurred.
+- (BOOL) _renewGroupKeyIfNeeded:(NSString*)groupId
+                    privateKeys:(nullable SealdGeneratedPrivateKeys*)privateKeys
+                          error:(NSError*_Nullable*)error
 {
     NSError* localErr = nil;
     BOOL shouldRenew;
-    [sdkInstance shouldRenewGroup:(NSString*)groupId ret0_:&shouldRenew error:&localErr];
+    [sdkInstance shouldRenewGroup:groupId ret0_:&shouldRenew error:&localErr];
     if (localErr) {
         _SealdInternal_ConvertError(localErr, error);
-        return;
+        return NO;
     }
     if (shouldRenew) {
         if (privateKeys == nil) {
             privateKeys = [self generatePrivateKeysWithError:&localErr];
             if (localErr) {
                 _SealdInternal_ConvertError(localErr, error);
-                return;
+                return NO;
             }
         }
-        [sdkInstance renewGroupKey:(NSString*)groupId
+        [sdkInstance renewGroupKey:groupId
                   preGeneratedKeys:privateKeys
                              error:&localErr
         ];
         if (localErr) {
             _SealdInternal_ConvertError(localErr, error);
-            return;
+            return NO;
         }
+        [self _invalidateCachedSessionsOfGroup:groupId];
+    }
+    return YES;
+}
+
+- (void) addGroupMembersWithGroupId:(const NSString*)groupId
+                       membersToAdd:(const NSArray<NSString*>*)membersToAdd
+                        adminsToSet:(const NSArray<NSString*>*)adminsToSet
+                        privateKeys:(nullable SealdGeneratedPrivateKeys*)privateKeys
+                              error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)))
+{
+    NSError* localErr = nil;
+    if (![self _renewGroupKeyIfNeeded:(NSString*)groupId privateKeys:privateKeys error:error]) {
+        return;
     }
     [sdkInstance addGroupMembers:(NSString*)groupId
                     membersToAdd:arrayToStringArray(((NSArray<NSString*>*)membersToAdd))
@@ -543,33 +716,15 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
                                  error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)))
 {
     NSError* localErr = nil;
-    BOOL shouldRenew;
-    [sdkInstance shouldRenewGroup:(NSString*)groupId ret0_:&shouldRenew error:&localErr];
-    if (localErr) {
-        _SealdInternal_ConvertError(localErr, error);
+    if (![self _renewGroupKeyIfNeeded:(NSString*)groupId privateKeys:privateKeys error:error]) {
         return;
     }
-    if (shouldRenew) {
-        if (privateKeys == nil) {
-            privateKeys = [self generatePrivateKeysWithError:&localErr];
-            if (localErr) {
-                _SealdInternal_ConvertError(localErr, error);
-                return;
-            }
-        }
-        [sdkInstance renewGroupKey:(NSString*)groupId
-                  preGeneratedKeys:privateKeys
-                             error:&localErr
-        ];
-        if (localErr) {
-            _SealdInternal_ConvertError(localErr, error);
-            return;
-        }
-    }
     [sdkInstance removeGroupMembers:(NSString*)groupId membersToRemove:arrayToStringArray(((NSArray<NSString*>*)membersToRemove)) error:&localErr];
     if (localErr) {
         _SealdInternal_ConvertError(localErr, error);
+        return;
     }
+    [self _invalidateCachedSessionsOfGroup:(NSString*)groupId ifRemovingMembers:(NSArray<NSString*>*)membersToRemove];
 }
 
 - (void) removeGroupMembersAsyncWithGroupId:(const NSString*)groupId
@@ -585,6 +740,183 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
     });
 }
 
+// Calls `action` on `chunk` on `queue`, and retries it after `options.retryDelay` times the attempt number while it fails with a transient error,
+// up to `options.retries` times. Calls `completion` with the error of the last attempt, or `nil` if an attempt succeeded.
+- (void) _applyToGroupMemberChunk:(NSArray<NSString*>*)chunk
+                          attempt:(NSInteger)attempt
+                          options:(SealdGroupMembersOptions*)options
+                            queue:(dispatch_queue_t)queue
+                           action:(BOOL (^)(NSArray<NSString*>* chunk, NSError*_Nullable* error))action
+                       completion:(void (^)(NSError*_Nullable error))completion
+{
+    dispatch_async(queue, ^{
+        NSError* localErr = nil;
+        if (action(chunk, &localErr)) {
+            completion(nil);
+            return;
+        }
+        if (attempt >= options.retries || !isTransientError(localErr)) {
+            completion(localErr);
+            return;
+        }
+        NSTimeInterval delay = options.retryDelay * (attempt + 1);
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), queue, ^{
+            [self _applyToGroupMemberChunk:chunk attempt:attempt + 1 options:options queue:queue action:action completion:completion];
+        });
+    });
+}
+
+// Splits `members` in chunks of `options.chunkSize`, and applies `action` to up to `options.maxConcurrency` chunks at the same time,
+// with retries as in _applyToGroupMemberChunk:attempt:options:queue:action:completion:. Retry delays do not hold a thread. Returns the status of each member.
+// The membership of the group cannot be read back, so a chunk whose last attempt failed is reported as failed for all its members,
+// even if an earlier attempt was partly applied.
+- (NSDictionary<NSString*, SealdActionStatus*>*) _applyToGroupMembers:(NSArray<NSString*>*)members
+                                                             options:(SealdGroupMembersOptions*)options
+                                                            progress:(SealdBulkProgressHandler _Nullable)progress
+                                                              action:(BOOL (^)(NSArray<NSString*>* chunk, NSError*_Nullable* error))action
+{
+    NSArray<NSString*>* uniqueMembers = [[NSOrderedSet orderedSetWithArray:members] array];
+    NSInteger total = [uniqueMembers count];
+    NSInteger chunkSize = MAX(options.chunkSize, 1);
+    NSInteger chunksCount = (total + chunkSize - 1) / chunkSize;
+    NSMutableDictionary<NSString*, SealdActionStatus*>* result = [NSMutableDictionary dictionaryWithCapacity:total];
+    __block NSInteger done = 0;
+    dispatch_group_t group = dispatch_group_create();
+    dispatch_semaphore_t slots = dispatch_semaphore_create(MAX(options.maxConcurrency, 1));
+    dispatch_queue_t queue = dispatch_get_global_queue(qos_class_self(), 0);
+    for (NSInteger chunkIndex = 0; chunkIndex < chunksCount; chunkIndex++) {
+        NSRange range = NSMakeRange(chunkIndex * chunkSize, MIN(chunkSize, total - chunkIndex * chunkSize));
+        NSArray<NSString*>* chunk = [uniqueMembers subarrayWithRange:range];
+        dispatch_semaphore_wait(slots, DISPATCH_TIME_FOREVER);
+        dispatch_group_enter(group);
+        [self _applyToGroupMemberChunk:chunk attempt:0 options:options queue:queue action:action completion:^(NSError*_Nullable chunkErr) {
+            SealdActionStatus* status = chunkErr ? [SealdActionStatus statusWithError:chunkErr] : [SealdActionStatus statusWithSuccess:true errorCode:@"" result:@""];
+            NSInteger doneNow;
+            @synchronized (result) {
+                for (NSString* member in chunk) {
+                    result[member] = status;
+                }
+                done += [chunk count];
+                doneNow = done;
+            }
+            if (progress) {
+                progress(doneNow, total);
+            }
+            dispatch_semaphore_signal(slots);
+            dispatch_group_leave(group);
+        }];
+    }
+    dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+    return result;
+}
+
+- (NSDictionary<NSString*, SealdActionStatus*>*) addGroupMembersWithGroupId:(const NSString*)groupId
+                                                               membersToAdd:(const NSArray<NSString*>*)membersToAdd
+                                                                adminsToSet:(const NSArray<NSString*>*)adminsToSet
+                                                                privateKeys:(nullable SealdGeneratedPrivateKeys*)privateKeys
+                                                                    options:(const SealdGroupMembersOptions*_Nullable)options
+                                                                   progress:(SealdBulkProgressHandler _Nullable)progress
+                                                                      error:(NSError*_Nullable*)error
+{
+    if (![self _renewGroupKeyIfNeeded:(NSString*)groupId privateKeys:privateKeys error:error]) {
+        return nil;
+    }
+    NSSet<NSString*>* admins = [NSSet setWithArray:(NSArray<NSString*>*)adminsToSet];
+    return [self _applyToGroupMembers:(NSArray<NSString*>*)membersToAdd
+                              options:(options ? (SealdGroupMembersOptions*)options : [[SealdGroupMembersOptions alloc] init])
+                             progress:progress
+                               action:^BOOL (NSArray<NSString*>* chunk, NSError*_Nullable* chunkError) {
+        NSMutableArray<NSString*>* chunkAdmins = [NSMutableArray array];
+        for (NSString* member in chunk) {
+            if ([admins containsObject:member]) {
+                [chunkAdmins addObject:member];
+            }
+        }
+        NSError* localErr = nil;
+        [self->sdkInstance addGroupMembers:(NSString*)groupId
+                              membersToAdd:arrayToStringArray(chunk)
+                               adminsToSet:arrayToStringArray(chunkAdmins)
+                                     error:&localErr];
+        if (localErr) {
+            _SealdInternal_ConvertError(localErr, chunkError);
+            return NO;
+        }
+        return YES;
+    }];
+}
+
+- (void) addGroupMembersAsyncWithGroupId:(const NSString*)groupId
+                            membersToAdd:(const NSArray<NSString*>*)membersToAdd
+                             adminsToSet:(const NSArray<NSString*>*)adminsToSet
+                             privateKeys:(nullable SealdGeneratedPrivateKeys*)privateKeys
+                                 options:(const SealdGroupMembersOptions*_Nullable)options
+                                progress:(SealdBulkProgressHandler _Nullable)progress
+                       completionHandler:(void (^)(NSDictionary<NSString*, SealdActionStatus*>* result, NSError*_Nullable error))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSError* localErr = nil;
+        NSDictionary<NSString*, SealdActionStatus*>* res = [self addGroupMembersWithGroupId:groupId
+                                                                               membersToAdd:membersToAdd
+                                                                                adminsToSet:adminsToSet
+                                                                                privateKeys:privateKeys
+                                                                                    options:options
+                                                                                   progress:progress
+                                                                                      error:&localErr];
+        completionHandler(res, localErr);
+    });
+}
+
+- (NSDictionary<NSString*, SealdActionStatus*>*) removeGroupMembersWithGroupId:(const NSString*)groupId
+                                                               membersToRemove:(const NSArray<NSString*>*)membersToRemove
+                                                                   privateKeys:(nullable SealdGeneratedPrivateKeys*)privateKeys
+                                                                       options:(const SealdGroupMembersOptions*_Nullable)options
+                                                                      progress:(SealdBulkProgressHandler _Nullable)progress
+                                                                         error:(NSError*_Nullable*)error
+{
+    if (![self _renewGroupKeyIfNeeded:(NSString*)groupId privateKeys:privateKeys error:error]) {
+        return nil;
+    }
+    NSDictionary<NSString*, SealdActionStatus*>* res = [self _applyToGroupMembers:(NSArray<NSString*>*)membersToRemove
+                                                                          options:(options ? (SealdGroupMembersOptions*)options : [[SealdGroupMembersOptions alloc] init])
+                                                                         progress:progress
+                                                                           action:^BOOL (NSArray<NSString*>* chunk, NSError*_Nullable* chunkError) {
+        NSError* localErr = nil;
+        [self->sdkInstance removeGroupMembers:(NSString*)groupId membersToRemove:arrayToStringArray(chunk) error:&localErr];
+        if (localErr) {
+            _SealdInternal_ConvertError(localErr, chunkError);
+            return NO;
+        }
+        return YES;
+    }];
+    NSMutableArray<NSString*>* removed = [NSMutableArray arrayWithCapacity:[res count]];
+    for (NSString* memberId in res) {
+        if (res[memberId].success) {
+            [removed addObject:memberId];
+        }
+    }
+    [self _invalidateCachedSessionsOfGroup:(NSString*)groupId ifRemovingMembers:removed];
+    return res;
+}
+
+- (void) removeGroupMembersAsyncWithGroupId:(const NSString*)groupId
+                            membersToRemove:(const NSArray<NSString*>*)membersToRemove
+                                privateKeys:(nullable SealdGeneratedPrivateKeys*)privateKeys
+                                    options:(const SealdGroupMembersOptions*_Nullable)options
+                                   progress:(SealdBulkProgressHandler _Nullable)progress
+                          completionHandler:(void (^)(NSDictionary<NSString*, SealdActionStatus*>* result, NSError*_Nullable error))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSError* localErr = nil;
+        NSDictionary<NSString*, SealdActionStatus*>* res = [self removeGroupMembersWithGroupId:groupId
+                                                                               membersToRemove:membersToRemove
+                                                                                   privateKeys:privateKeys
+                                                                                       options:options
+                                                                                      progress:progress
+                                                                                         error:&localErr];
+        completionHandler(res, localErr);
+    });
+}
+
 - (void) renewGroupKeyWithGroupId:(const NSString*)groupId
                       privateKeys:(nullable SealdGeneratedPrivateKeys*)privateKeys
                             error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)))
@@ -603,7 +935,9 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
     ];
     if (localErr) {
         _SealdInternal_ConvertError(localErr, error);
+        return;
     }
+    [self _invalidateCachedSessionsOfGroup:(NSString*)groupId];
 }
 
 - (void) renewGroupKeyAsyncWithGroupId:(const NSString*)groupId
@@ -618,6 +952,157 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
     });
 }
 
+- (BOOL) shouldRenewGroupWithGroupId:(const NSString*)groupId
+                               error:(NSError*_Nullable*)error
+{
+    NSError* localErr = nil;
+    BOOL shouldRenew = NO;
+    [sdkInstance shouldRenewGroup:(NSString*)groupId ret0_:&shouldRenew error:&localErr];
+    if (localErr) {
+        _SealdInternal_ConvertError(localErr, error);
+        return NO;
+    }
+    return shouldRenew;
+}
+
+- (SealdGroupKeyRenewalReport*) shouldRenewGroups:(const NSArray<NSString*>*)groupIds
+{
+    NSArray<NSString*>* uniqueGroupIds = [[NSOrderedSet orderedSetWithArray:(NSArray<NSString*>*)groupIds] array];
+    NSMutableArray<NSString*>* needingRenewal = [NSMutableArray array];
+    NSMutableDictionary<NSString*, SealdActionStatus*>* failed = [NSMutableDictionary dictionary];
+    runConcurrently([uniqueGroupIds count], defaultMaxConcurrency, ^(NSInteger i) {
+        NSError* localErr = nil;
+        BOOL shouldRenew = [self shouldRenewGroupWithGroupId:uniqueGroupIds[i] error:&localErr];
+        @synchronized (failed) {
+            if (localErr) {
+                failed[uniqueGroupIds[i]] = [SealdActionStatus statusWithError:localErr];
+            } else if (shouldRenew) {
+                [needingRenewal addObject:uniqueGroupIds[i]];
+            }
+        }
+    });
+    return [[SealdGroupKeyRenewalReport alloc] initWithNeedingRenewal:needingRenewal renewed:@[] failed:failed];
+}
+
+- (void) shouldRenewGroupsAsync:(const NSArray<NSString*>*)groupIds
+              completionHandler:(void (^)(SealdGroupKeyRenewalReport* result))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        SealdGroupKeyRenewalReport* res = [self shouldRenewGroups:groupIds];
+
+        completionHandler(res);
+    });
+}
+
+// Returns the spare pre-generated keys, or generates new ones if there are none.
+- (SealdGeneratedPrivateKeys*) _takeSpareGroupKeys:(NSError*_Nullable*)error
+{
+    SealdGeneratedPrivateKeys* keys = nil;
+    @synchronized (self) {
+        keys = spareGroupKeys;
+        spareGroupKeys = nil;
+    }
+    if (keys != nil) {
+        return keys;
+    }
+    return [self generatePrivateKeysWithError:error];
+}
+
+// Generates spare keys for the next renewal, if there are none.
+- (void) _refillSpareGroupKeys
+{
+    @synchronized (self) {
+        if (spareGroupKeys != nil) {
+            return;
+        }
+    }
+    NSError* localErr = nil;
+    SealdGeneratedPrivateKeys* keys = [self generatePrivateKeysWithError:&localErr];
+    if (localErr) {
+        return;
+    }
+    @synchronized (self) {
+        spareGroupKeys = keys;
+    }
+}
+
+- (SealdGroupKeyRenewalReport*) renewGroupKeysIfNeeded:(const NSArray<NSString*>*)groupIds
+{
+    SealdGroupKeyRenewalReport* check = [self shouldRenewGroups:groupIds];
+    NSMutableArray<NSString*>* renewed = [NSMutableArray array];
+    NSMutableDictionary<NSString*, SealdActionStatus*>* failed = [check.failed mutableCopy];
+    for (NSString* groupId in check.needingRenewal) {
+        NSError* localErr = nil;
+        SealdGeneratedPrivateKeys* keys = [self _takeSpareGroupKeys:&localErr];
+        if (!localErr) {
+            [self renewGroupKeyWithGroupId:groupId privateKeys:keys error:&localErr];
+        }
+        if (localErr) {
+            failed[groupId] = [SealdActionStatus statusWithError:localErr];
+        } else {
+            [renewed addObject:groupId];
+        }
+        [self _refillSpareGroupKeys];
+    }
+    return [[SealdGroupKeyRenewalReport alloc] initWithNeedingRenewal:check.needingRenewal renewed:renewed failed:failed];
+}
+
+- (void) renewGroupKeysIfNeededAsync:(const NSArray<NSString*>*)groupIds
+                   completionHandler:(void (^)(SealdGroupKeyRenewalReport* result))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        SealdGroupKeyRenewalReport* res = [self renewGroupKeysIfNeeded:groupIds];
+
+        completionHandler(res);
+    });
+}
+
+- (void) startGroupKeyRenewalWithGroupIds:(const NSArray<NSString*>*)groupIds
+                                 interval:(NSTimeInterval)interval
+                                   onPass:(void (^_Nullable)(SealdGroupKeyRenewalReport* report))onPass
+                                    error:(NSError*_Nullable*)error
+{
+    // A timer with a zero interval would fire continuously.
+    if (!(interval > 0)) {
+        _SealdInternal_SetError(@"INVALID_INTERVAL", @"The renewal interval must be greater than 0", error);
+        return;
+    }
+    [self stopGroupKeyRenewal];
+    NSArray<NSString*>* groupIdsCopy = [(NSArray<NSString*>*)groupIds copy];
+    dispatch_queue_t queue = dispatch_queue_create("io.seald.SealdSdk.groupKeyRenewal", dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_BACKGROUND, 0));
+    dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, queue);
+    // A generous leeway lets the system coalesce passes with other background work.
+    dispatch_source_set_timer(timer, dispatch_time(DISPATCH_TIME_NOW, 0), (uint64_t)(interval * NSEC_PER_SEC), (uint64_t)(interval * NSEC_PER_SEC / 10));
+    __weak SealdSdk* weakSelf = self;
+    dispatch_source_set_event_handler(timer, ^{
+        SealdSdk* strongSelf = weakSelf;
+        if (strongSelf == nil) {
+            return;
+        }
+        SealdGroupKeyRenewalReport* report = [strongSelf renewGroupKeysIfNeeded:groupIdsCopy];
+        [strongSelf _refillSpareGroupKeys];
+        if (onPass) {
+            onPass(report);
+        }
+    });
+    @synchronized (self) {
+        groupKeyRenewalTimer = timer;
+    }
+    dispatch_resume(timer);
+}
+
+- (void) stopGroupKeyRenewal
+{
+    dispatch_source_t timer = nil;
+    @synchronized (self) {
+        timer = groupKeyRenewalTimer;
+        groupKeyRenewalTimer = nil;
+    }
+    if (timer != nil) {
+        dispatch_source_cancel(timer);
+    }
+}
+
 - (void) setGroupAdminsWithGroupId:(const NSString*)groupId
                        addToAdmins:(const NSArray<NSString*>*)addToAdmins
                   removeFromAdmins:(const NSArray<NSString*>*)removeFromAdmins
@@ -647,30 +1132,486 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
 }
 
 // EncryptionSession
-- (SealdEncryptionSession*) createEncryptionSessionWithRecipients:(const NSArray<SealdRecipientWithRights*>*)recipients
-                                                         metadata:(const NSString*_Nullable)metadata
-                                                         useCache:(const BOOL)useCache
-                                                            error:(NSError*_Nullable*)error
+// Deserializes a session from the session store. Returns `nil` if there is no store or the session is not in it,
+// and removes it from the store if it cannot be deserialized.
+- (SealdEncryptionSession*) _loadStoredSessionWithId:(NSString*)sessionId
 {
+    if (sessionStore == nil) {
+        return nil;
+    }
+    NSString* serialized = [sessionStore loadSessionWithId:sessionId];
+    if (serialized == nil) {
+        return nil;
+    }
     NSError* localErr = nil;
-    SealdSdkInternalsMobile_sdkMobileEncryptionSession* es = [sdkInstance createEncryptionSession:[SealdRecipientWithRights toMobileSdkArray:(NSArray<SealdRecipientWithRights*>*)recipients]
-                                                                                         metadata:(NSString*)metadata
-                                                                                         useCache:useCache
-                                                                                            error:&localErr];
+    SealdSdkInternalsMobile_sdkMobileEncryptionSession* es = [sdkInstance deserializeEncryptionSession:serialized error:&localErr];
     if (localErr) {
-        _SealdInternal_ConvertError(localErr, error);
+        [sessionStore removeSessionWithId:sessionId];
         return nil;
     }
-    return [SealdEncryptionSession fromMobileSdk:es];
+    SealdEncryptionSession* res = [SealdEncryptionSession fromMobileSdk:es];
+    [self _trackSession:res];
+    return res;
 }
 
-- (void) createEncryptionSessionAsyncWithRecipients:(const NSArray<SealdRecipientWithRights*>*)recipients
-                                           metadata:(const NSString*_Nullable)metadata
-                                           useCache:(const BOOL)useCache
-                                  completionHandler:(void (^)(SealdEncryptionSession* encryptionSession, NSError* error))completionHandler
+// Returns the session from the memory cache, or else from the session store, or `nil` if it is in neither.
+- (SealdEncryptionSession*) _cachedSessionWithId:(NSString*)sessionId
 {
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
-        NSError* localErr = nil;
+    if ([sessionId length] == 0) {
+        return nil;
+    }
+    SealdEncryptionSession* es = [sessionCache sessionWithId:sessionId];
+    if (es != nil) {
+        [cacheStats recordRetrievalWithFlow:es.retrievalDetails.flow source:SealdCacheSourceMemory];
+    } else {
+        es = [self _loadStoredSessionWithId:sessionId];
+        if (es != nil) {
+            [cacheStats recordRetrievalWithFlow:es.retrievalDetails.flow source:SealdCacheSourceStore];
+            [sessionCache setSession:es];
+        }
+    }
+    if (es != nil) {
+        [sessionStore recordUseOfSessionWithId:sessionId];
+    }
+    return es;
+}
+
+// Removes the session from the memory cache and the session store when a revocation through this instance
+// removes the access of the current user: revokeAll, or revoking the current user, the group or the proxy session it was retrieved via.
+- (void) _trackSession:(SealdEncryptionSession*)es
+{
+    SealdSessionCache* cache = sessionCache;
+    SealdSessionStore* store = sessionStore;
+    if (cache == nil && store == nil) {
+        return;
+    }
+    // Not `es` itself, which would retain itself through its own callback.
+    NSString* groupId = es.retrievalDetails.groupId;
+    NSString* proxySessionId = es.retrievalDetails.proxySessionId;
+    __weak SealdSdk* weakSelf = self;
+    es.onRevoke = ^(NSString* sessionId, NSArray<NSString*>* sealdIds, NSArray<NSString*>* proxySessionsIds) {
+        BOOL invalidate = sealdIds == nil && proxySessionsIds == nil;
+        if (!invalidate) {
+            NSString* userId = [weakSelf getCurrentAccountInfo].userId;
+            invalidate = (userId != nil && [sealdIds containsObject:userId])
+                || (groupId != nil && [sealdIds containsObject:groupId])
+                || (proxySessionId != nil && [proxySessionsIds containsObject:proxySessionId]);
+        }
+        if (invalidate) {
+            [cache removeSessionWithId:sessionId];
+            [store removeSessionWithId:sessionId];
+        }
+    };
+}
+
+// Removes the sessions retrieved via `groupId` from the memory cache and the session store. Returns their IDs.
+- (NSArray<NSString*>*) _invalidateCachedSessionsOfGroup:(NSString*)groupId
+{
+    NSMutableOrderedSet<NSString*>* sessionIds = [NSMutableOrderedSet orderedSet];
+    for (SealdCacheEntryInfo* entry in [self listCacheEntries]) {
+        if ([entry.retrievalDetails.groupId isEqualToString:groupId]) {
+            [sessionIds addObject:entry.sessionId];
+        }
+    }
+    if (sessionStore != nil) {
+        [sessionIds addObjectsFromArray:[sessionStore sessionIdsOfGroup:groupId]];
+    }
+    [self clearCacheForEncryptionSessionIds:[sessionIds array]];
+    return [sessionIds array];
+}
+
+// Invalidates the sessions of `groupId` if the current user is among `members`.
+- (void) _invalidateCachedSessionsOfGroup:(NSString*)groupId
+                        ifRemovingMembers:(NSArray<NSString*>*)members
+{
+    if (sessionCache == nil && sessionStore == nil) {
+        return;
+    }
+    NSString* userId = [self getCurrentAccountInfo].userId;
+    if (userId != nil && [members containsObject:userId]) {
+        [self _invalidateCachedSessionsOfGroup:groupId];
+    }
+}
+
+// Tracks the session, and if `useCache` is set, caches it in memory and stores it in the background.
+- (SealdEncryptionSession*) _didRetrieveSession:(SealdEncryptionSession*)es
+                                       useCache:(BOOL)useCache
+{
+    [cacheStats recordRetrievalWithFlow:es.retrievalDetails.flow source:es.retrievalDetails.fromCache ? SealdCacheSourceNativeCache : SealdCacheSourceNetwork];
+    [self _trackSession:es];
+    if (!useCache) {
+        return es;
+    }
+    [sessionCache setSession:es];
+    SealdSessionStore* store = sessionStore;
+    NSTimeInterval ttl = [self _cacheTTLForSessionId:es.sessionId];
+    if (store != nil && ttl != 0) {
+        [store recordUseOfSessionWithId:es.sessionId];
+        NSDate* expiresAt = ttl < 0 ? nil : [NSDate dateWithTimeIntervalSinceNow:ttl];
+        dispatch_group_async(sessionStoreWrites, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+            NSError* localErr = nil;
+            NSString* serialized = [es serializeWithError:&localErr];
+            if (serialized != nil) {
+                [store saveSession:serialized withId:es.sessionId groupId:es.retrievalDetails.groupId expiresAt:expiresAt];
+            }
+        });
+    }
+    return es;
+}
+
+// The TTL that applies to a session, in the memory cache and in the session store alike.
+- (NSTimeInterval) _cacheTTLForSessionId:(NSString*)sessionId
+{
+    if (sessionCache != nil) {
+        return [sessionCache ttlForSessionWithId:sessionId];
+    }
+    return [[sessionStore pinnedSessionIds] containsObject:sessionId] ? -1 : sessionCacheTTL;
+}
+
+// Applies the current TTL of a session to its stored copy, counted from now, and removes it if its TTL is now `0`.
+- (void) _updateStoredExpiryOfSessionWithId:(NSString*)sessionId
+{
+    SealdSessionStore* store = sessionStore;
+    if (store == nil) {
+        return;
+    }
+    NSTimeInterval ttl = [self _cacheTTLForSessionId:sessionId];
+    dispatch_group_async(sessionStoreWrites, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        if (ttl == 0) {
+            [store removeSessionWithId:sessionId];
+        } else {
+            [store setExpiresAt:ttl < 0 ? nil : [NSDate dateWithTimeIntervalSinceNow:ttl] forSessionWithId:sessionId];
+        }
+    });
+}
+
+// Loads the pinned and the `count` most recently used sessions from the session store into the memory cache.
+- (void) _warmUpSessionCacheWithCount:(NSInteger)count
+                    cancellationToken:(SealdCancellationToken*)cancellationToken
+{
+    NSMutableOrderedSet<NSString*>* sessionIds = [NSMutableOrderedSet orderedSetWithArray:[sessionStore pinnedSessionIds]];
+    [sessionIds addObjectsFromArray:[sessionStore recentSessionIdsWithLimit:count]];
+    for (NSString* sessionId in sessionIds) {
+        if ([cancellationToken isCancelled]) {
+            return;
+        }
+        if ([sessionCache containsSessionWithId:sessionId]) {
+            continue;
+        }
+        SealdEncryptionSession* es = [self _loadStoredSessionWithId:sessionId];
+        if (es != nil) {
+            [sessionCache setSession:es];
+        }
+    }
+}
+
+- (BOOL) pinEncryptionSessionWithId:(const NSString*)sessionId
+{
+    if (sessionCache != nil && ![sessionCache setPinned:YES forSessionWithId:(NSString*)sessionId]) {
+        return NO;
+    }
+    [sessionStore setPinned:YES forSessionWithId:(NSString*)sessionId];
+    [self _updateStoredExpiryOfSessionWithId:(NSString*)sessionId];
+    return YES;
+}
+
+- (void) unpinEncryptionSessionWithId:(const NSString*)sessionId
+{
+    [sessionCache setPinned:NO forSessionWithId:(NSString*)sessionId];
+    [sessionStore setPinned:NO forSessionWithId:(NSString*)sessionId];
+    [self _updateStoredExpiryOfSessionWithId:(NSString*)sessionId];
+}
+
+- (void) setCacheTTL:(const NSTimeInterval)ttl
+forEncryptionSessionWithId:(const NSString*)sessionId
+{
+    [sessionCache setTTL:ttl forSessionWithId:(NSString*)sessionId];
+    [self _updateStoredExpiryOfSessionWithId:(NSString*)sessionId];
+}
+
+- (void) removeCacheTTLForEncryptionSessionWithId:(const NSString*)sessionId
+{
+    [sessionCache removeTTLForSessionWithId:(NSString*)sessionId];
+    [self _updateStoredExpiryOfSessionWithId:(NSString*)sessionId];
+}
+
+- (SealdCacheStats*) getCacheStats
+{
+    return [[SealdCacheStats alloc] initWithFlows:[cacheStats flowStats]
+                                            total:[cacheStats totalStats]
+                                    memoryEntries:sessionCache.count
+                                    pinnedEntries:sessionCache.pinnedCount
+                                     storeEntries:sessionStore.count
+                                        storeSize:[sessionStore diskSize]
+                                 expiredEvictions:sessionCache.expiredEvictions
+                                capacityEvictions:sessionCache.capacityEvictions
+                                    invalidations:sessionCache.invalidations
+                                   storeEvictions:sessionStore.evictions];
+}
+
+- (void) resetCacheStats
+{
+    [cacheStats reset];
+    [sessionCache resetCounters];
+    [sessionStore resetCounters];
+}
+
+- (NSArray<SealdCacheEntryInfo*>*) listCacheEntries
+{
+    return sessionCache != nil ? [sessionCache entriesInfo] : @[];
+}
+
+- (void) clearCacheForEncryptionSessionIds:(const NSArray<NSString*>*)sessionIds
+{
+    for (NSString* sessionId in sessionIds) {
+        [sessionCache removeSessionWithId:sessionId];
+        [sessionStore removeSessionWithId:sessionId];
+    }
+}
+
+- (void) clearCacheMatching:(BOOL (^)(SealdCacheEntryInfo* entry))predicate
+{
+    NSMutableArray<NSString*>* sessionIds = [NSMutableArray array];
+    for (SealdCacheEntryInfo* entry in [self listCacheEntries]) {
+        if (predicate(entry)) {
+            [sessionIds addObject:entry.sessionId];
+        }
+    }
+    [self clearCacheForEncryptionSessionIds:sessionIds];
+}
+
+- (void) clearCache
+{
+    [sessionCache removeAllSessions];
+    [sessionStore removeAllSessions];
+}
+
+// Invalidates the sessions of the groups whose sigchain changed since the last poll. Returns their IDs.
+- (NSArray<NSString*>*) _invalidateChangedGroups
+{
+    NSMutableSet<NSString*>* groupIds = [NSMutableSet setWithArray:[sessionStore groupIds] ?: @[]];
+    for (SealdCacheEntryInfo* entry in [self listCacheEntries]) {
+        if (entry.retrievalDetails.groupId != nil) {
+            [groupIds addObject:entry.retrievalDetails.groupId];
+        }
+    }
+    NSMutableArray<NSString*>* invalidated = [NSMutableArray array];
+    for (NSString* groupId in groupIds) {
+        NSError* localErr = nil;
+        SealdGetSigchainResponse* resp = [self getSigchainHashWithUserId:groupId position:-1 error:&localErr];
+        if (localErr) {
+            continue;
+        }
+        NSString* previousHash = nil;
+        @synchronized (groupSigchainHashes) {
+            previousHash = groupSigchainHashes[groupId];
+            groupSigchainHashes[groupId] = resp.sigchainHash;
+        }
+        [sessionStore setSigchainHash:resp.sigchainHash forGroupId:groupId];
+        if (previousHash != nil && ![previousHash isEqualToString:resp.sigchainHash]) {
+            [invalidated addObjectsFromArray:[self _invalidateCachedSessionsOfGroup:groupId]];
+        }
+    }
+    return invalidated;
+}
+
+// Retrieves again, bypassing caches, up to `batchSize` sessions of the memory cache or the session store, least recently checked first,
+// and invalidates those to which the server denies access. Returns their IDs.
+// Only sessions that the current user retrieves on its own are checked: created, retrieved directly, via a group, or via a proxy.
+- (NSArray<NSString*>*) _revalidateCachedSessionsWithBatchSize:(NSInteger)batchSize
+{
+    if (batchSize <= 0) {
+        return @[];
+    }
+    BOOL (^canRevalidate)(SealdEncryptionSessionRetrievalFlow) = ^BOOL (SealdEncryptionSessionRetrievalFlow flow) {
+        return flow == SealdEncryptionSessionRetrievalCreated || flow == SealdEncryptionSessionRetrievalDirect
+            || flow == SealdEncryptionSessionRetrievalViaGroup || flow == SealdEncryptionSessionRetrievalViaProxy;
+    };
+    // Flows are known for sessions in memory. Stored sessions are only loaded if they are picked, to find theirs.
+    NSMutableDictionary<NSString*, NSNumber*>* flows = [NSMutableDictionary dictionary];
+    NSMutableOrderedSet<NSString*>* candidates = [NSMutableOrderedSet orderedSet];
+    for (SealdCacheEntryInfo* entry in [self listCacheEntries]) {
+        flows[entry.sessionId] = @(entry.retrievalDetails.flow);
+        [candidates addObject:entry.sessionId];
+    }
+    if (sessionStore != nil) {
+        [candidates addObjectsFromArray:[sessionStore recentSessionIdsWithLimit:sessionStore.maxEntries]];
+        [candidates addObjectsFromArray:[sessionStore pinnedSessionIds]];
+    }
+    NSDictionary<NSString*, NSDate*>* dates = nil;
+    @synchronized (revalidationDates) {
+        dates = [revalidationDates copy];
+    }
+    NSArray<NSString*>* sorted = [[candidates array] sortedArrayUsingComparator:^NSComparisonResult (NSString* a, NSString* b) {
+        return [(dates[a] ?: [NSDate distantPast]) compare:(dates[b] ?: [NSDate distantPast])];
+    }];
+    NSMutableArray<NSString*>* sessionIds = [NSMutableArray arrayWithCapacity:batchSize];
+    NSMutableArray<NSString*>* skipped = [NSMutableArray array];
+    for (NSString* sessionId in sorted) {
+        if ((NSInteger)[sessionIds count] >= batchSize) {
+            break;
+        }
+        NSNumber* flow = flows[sessionId];
+        if (flow == nil) {
+            SealdEncryptionSession* stored = [self _loadStoredSessionWithId:sessionId];
+            if (stored == nil) {
+                continue;
+            }
+            flow = @(stored.retrievalDetails.flow);
+        }
+        if (canRevalidate([flow integerValue])) {
+            [sessionIds addObject:sessionId];
+        } else {
+            // Counted as checked, so that it does not take the place of other sessions on every poll.
+            [skipped addObject:sessionId];
+        }
+    }
+    if ([sessionIds count] == 0) {
+        return @[];
+    }
+
+    NSMutableArray<NSString*>* invalidated = [NSMutableArray array];
+    NSMutableArray<NSString*>* checked = [NSMutableArray arrayWithArray:skipped];
+    NSError* localErr = nil;
+    [sdkInstance retrieveMultipleEncryptionSessions:arrayToStringArray(sessionIds) useCache:NO lookupProxyKey:YES lookupGroupKey:YES error:&localErr];
+    if (!localErr) {
+        [checked addObjectsFromArray:sessionIds];
+    } else {
+        // The batch call fails as a whole when any session fails: check them one by one to find which ones.
+        for (NSString* sessionId in sessionIds) {
+            NSError* nativeErr = nil;
+            NSError* err = nil;
+            [sdkInstance retrieveEncryptionSession:sessionId useCache:NO lookupProxyKey:YES lookupGroupKey:YES error:&nativeErr];
+            _SealdInternal_ConvertError(nativeErr, &err);
+            if (err == nil) {
+                [checked addObject:sessionId];
+            } else if (isAccessDeniedError(err)) {
+                [checked addObject:sessionId];
+                [invalidated addObject:sessionId];
+            }
+        }
+        [self clearCacheForEncryptionSessionIds:invalidated];
+    }
+    NSDate* now = [NSDate date];
+    @synchronized (revalidationDates) {
+        for (NSString* sessionId in checked) {
+            revalidationDates[sessionId] = now;
+        }
+        for (NSString* sessionId in invalidated) {
+            [revalidationDates removeObjectForKey:sessionId];
+        }
+    }
+    return invalidated;
+}
+
+- (NSArray<NSString*>*) pollCacheInvalidationsWithOptions:(const SealdCacheInvalidationOptions*_Nullable)options
+{
+    SealdCacheInvalidationOptions* opts = options != nil ? (SealdCacheInvalidationOptions*)options : [[SealdCacheInvalidationOptions alloc] init];
+    if (sessionCache == nil && sessionStore == nil) {
+        return @[];
+    }
+    NSMutableArray<NSString*>* invalidated = [NSMutableArray array];
+    [invalidated addObjectsFromArray:[self _invalidateChangedGroups]];
+    [invalidated addObjectsFromArray:[self _revalidateCachedSessionsWithBatchSize:opts.revalidationBatchSize]];
+    return invalidated;
+}
+
+- (void) pollCacheInvalidationsAsyncWithOptions:(const SealdCacheInvalidationOptions*_Nullable)options
+                              completionHandler:(void (^)(NSArray<NSString*>* invalidatedSessionIds))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSArray<NSString*>* res = [self pollCacheInvalidationsWithOptions:options];
+
+        completionHandler(res);
+    });
+}
+
+- (void) startCacheInvalidationPollWithOptions:(const SealdCacheInvalidationOptions*_Nullable)options
+                                        onPass:(void (^_Nullable)(NSArray<NSString*>* invalidatedSessionIds))onPass
+                                         error:(NSError*_Nullable*)error
+{
+    SealdCacheInvalidationOptions* opts = options != nil ? (SealdCacheInvalidationOptions*)options : [[SealdCacheInvalidationOptions alloc] init];
+    // A timer with a zero interval would fire continuously.
+    if (!(opts.pollInterval > 0)) {
+        _SealdInternal_SetError(@"INVALID_INTERVAL", @"The poll interval must be greater than 0", error);
+        return;
+    }
+    [self stopCacheInvalidationPoll];
+    dispatch_queue_t queue = dispatch_queue_create("io.seald.SealdSdk.cacheInvalidation", dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0));
+    dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, queue);
+    dispatch_source_set_timer(timer, dispatch_time(DISPATCH_TIME_NOW, 0), (uint64_t)(opts.pollInterval * NSEC_PER_SEC), (uint64_t)(opts.pollInterval * NSEC_PER_SEC / 10));
+    __weak SealdSdk* weakSelf = self;
+    dispatch_source_set_event_handler(timer, ^{
+        SealdSdk* strongSelf = weakSelf;
+        if (strongSelf == nil) {
+            return;
+        }
+        NSArray<NSString*>* invalidated = [strongSelf pollCacheInvalidationsWithOptions:opts];
+        if (onPass) {
+            onPass(invalidated);
+        }
+    });
+    @synchronized (self) {
+        cacheInvalidationTimer = timer;
+    }
+    dispatch_resume(timer);
+}
+
+- (void) stopCacheInvalidationPoll
+{
+    dispatch_source_t timer = nil;
+    @synchronized (self) {
+        timer = cacheInvalidationTimer;
+        cacheInvalidationTimer = nil;
+    }
+    if (timer != nil) {
+        dispatch_source_cancel(timer);
+    }
+}
+
+- (SealdEncryptionSession*) createEncryptionSessionWithRecipients:(const NSArray<SealdRecipientWithRights*>*)recipients
+                                                         metadata:(const NSString*_Nullable)metadata
+                                                         useCache:(const BOOL)useCache
+                                                            error:(NSError*_Nullable*)error
+{
+    // Pooled sessions are created with `useCache:YES`, so they cannot be handed out when the caller asked to bypass the cache.
+    SealdEncryptionSessionPool* pool = nil;
+    @synchronized (sessionPools) {
+        if (useCache && [sessionPools count] > 0) {
+            pool = sessionPools[[SealdEncryptionSessionPool keyForRecipients:recipients metadata:metadata]];
+        }
+    }
+    SealdEncryptionSession* pooled = [pool take];
+    if (pooled != nil) {
+        return pooled;
+    }
+    return [self _createEncryptionSessionWithRecipients:recipients metadata:metadata useCache:useCache error:error];
+}
+
+- (SealdEncryptionSession*) _createEncryptionSessionWithRecipients:(const NSArray<SealdRecipientWithRights*>*)recipients
+                                                          metadata:(const NSString*_Nullable)metadata
+                                                          useCache:(const BOOL)useCache
+                                                             error:(NSError*_Nullable*)error
+{
+    NSError* localErr = nil;
+    SealdSdkInternalsMobile_sdkMobileEncryptionSession* es = [sdkInstance createEncryptionSession:[SealdRecipientWithRights toMobileSdkArray:(NSArray<SealdRecipientWithRights*>*)recipients]
+                                                                                         metadata:(NSString*)metadata
+                                                                                         useCache:useCache
+                                                                                            error:&localErr];
+    if (localErr) {
+        _SealdInternal_ConvertError(localErr, error);
+        return nil;
+    }
+    return [self _didRetrieveSession:[SealdEncryptionSession fromMobileSdk:es] useCache:useCache];
+}
+
+- (void) createEncryptionSessionAsyncWithRecipients:(const NSArray<SealdRecipientWithRights*>*)recipients
+                                           metadata:(const NSString*_Nullable)metadata
+                                           useCache:(const BOOL)useCache
+                                  completionHandler:(void (^)(SealdEncryptionSession* encryptionSession, NSError* error))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSError* localErr = nil;
         SealdEncryptionSession* res = [self createEncryptionSessionWithRecipients:recipients
                                                                          metadata:metadata
                                                                          useCache:useCache
@@ -680,12 +1621,105 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
     });
 }
 
+- (void) registerEncryptionSessionPoolWithRecipients:(const NSArray<SealdRecipientWithRights*>*)recipients
+                                            metadata:(const NSString*_Nullable)metadata
+                                                size:(const NSInteger)size
+                                              maxAge:(const NSTimeInterval)maxAge
+                                       onRefillError:(void (^_Nullable)(NSError* error))onRefillError
+{
+    NSArray<SealdRecipientWithRights*>* poolRecipients = [(NSArray<SealdRecipientWithRights*>*)recipients copy];
+    NSString* poolMetadata = (NSString*)metadata;
+    __weak SealdSdk* weakSelf = self;
+    SealdEncryptionSessionPool* pool = [[SealdEncryptionSessionPool alloc] initWithRecipients:poolRecipients
+                                                                                     metadata:poolMetadata
+                                                                                         size:size
+                                                                                       maxAge:maxAge
+                                                                                createSession:^SealdEncryptionSession*(NSError** error) {
+        return [weakSelf _createEncryptionSessionWithRecipients:poolRecipients metadata:poolMetadata useCache:YES error:error];
+    }
+                                                                                onRefillError:onRefillError];
+    NSString* key = [SealdEncryptionSessionPool keyForRecipients:recipients metadata:metadata];
+    @synchronized (sessionPools) {
+        [sessionPools[key] drain];
+        sessionPools[key] = pool;
+    }
+    [pool refill];
+}
+
+- (void) unregisterEncryptionSessionPoolWithRecipients:(const NSArray<SealdRecipientWithRights*>*)recipients
+                                              metadata:(const NSString*_Nullable)metadata
+{
+    NSString* key = [SealdEncryptionSessionPool keyForRecipients:recipients metadata:metadata];
+    @synchronized (sessionPools) {
+        [sessionPools[key] drain];
+        [sessionPools removeObjectForKey:key];
+    }
+}
+
+- (NSArray<SealdEncryptionSession*>*) createEncryptionSessionsWithRecipientSets:(const NSArray<NSArray<SealdRecipientWithRights*>*>*)recipientSets
+                                                                      metadata:(const NSString*_Nullable)metadata
+                                                                      useCache:(const BOOL)useCache
+                                                                         error:(NSError*_Nullable*)error
+{
+    // The API has no multi-session creation endpoint: creations are pipelined instead, to overlap their round trips.
+    NSInteger count = [recipientSets count];
+    NSMutableArray* sessions = [NSMutableArray arrayWithCapacity:count];
+    NSMutableArray* errors = [NSMutableArray arrayWithCapacity:count];
+    for (NSInteger i = 0; i < count; i++) {
+        [sessions addObject:[NSNull null]];
+        [errors addObject:[NSNull null]];
+    }
+    runConcurrently(count, defaultMaxConcurrency, ^(NSInteger i) {
+        NSError* localErr = nil;
+        SealdEncryptionSession* es = [self createEncryptionSessionWithRecipients:recipientSets[i]
+                                                                        metadata:metadata
+                                                                        useCache:useCache
+                                                                           error:&localErr];
+        @synchronized (sessions) {
+            if (localErr) {
+                errors[i] = localErr;
+            } else {
+                sessions[i] = es;
+            }
+        }
+    });
+    for (id err in errors) {
+        if (err != [NSNull null]) {
+            if (error) *error = err;
+            return nil;
+        }
+    }
+    return sessions;
+}
+
+- (void) createEncryptionSessionsAsyncWithRecipientSets:(const NSArray<NSArray<SealdRecipientWithRights*>*>*)recipientSets
+                                              metadata:(const NSString*_Nullable)metadata
+                                              useCache:(const BOOL)useCache
+                                     completionHandler:(void (^)(NSArray<SealdEncryptionSession*>* encryptionSessions, NSError* error))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSError* localErr = nil;
+        NSArray<SealdEncryptionSession*>* res = [self createEncryptionSessionsWithRecipientSets:recipientSets
+                                                                                       metadata:metadata
+                                                                                       useCache:useCache
+                                                                                          error:&localErr];
+
+        completionHandler(res, localErr);
+    });
+}
+
 - (SealdEncryptionSession*) retrieveEncryptionSessionWithSessionId:(const NSString*)sessionId
                                                           useCache:(const BOOL)useCache
                                                     lookupProxyKey:(const BOOL)lookupProxyKey
                                                     lookupGroupKey:(const BOOL)lookupGroupKey
                                                              error:(NSError*_Nullable*)error
 {
+    if (useCache) {
+        SealdEncryptionSession* stored = [self _cachedSessionWithId:(NSString*)sessionId];
+        if (stored != nil) {
+            return stored;
+        }
+    }
     NSError* localErr = nil;
     SealdSdkInternalsMobile_sdkMobileEncryptionSession* es = [sdkInstance retrieveEncryptionSession:(NSString*)sessionId
                                                                                            useCache:useCache
@@ -696,7 +1730,7 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
         _SealdInternal_ConvertError(localErr, error);
         return nil;
     }
-    return [SealdEncryptionSession fromMobileSdk:es];
+    return [self _didRetrieveSession:[SealdEncryptionSession fromMobileSdk:es] useCache:useCache];
 }
 
 - (void) retrieveEncryptionSessionAsyncWithSessionId:(const NSString*)sessionId
@@ -723,6 +1757,12 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
                                                   lookupGroupKey:(const BOOL)lookupGroupKey
                                                            error:(NSError*_Nullable*)error
 {
+    if (useCache && (sessionCache != nil || sessionStore != nil)) {
+        SealdEncryptionSession* stored = [self _cachedSessionWithId:SealdSdkInternalsMobile_sdkParseSessionIdFromMessage((NSString*)message, nil)];
+        if (stored != nil) {
+            return stored;
+        }
+    }
     NSError* localErr = nil;
     SealdSdkInternalsMobile_sdkMobileEncryptionSession* es = [sdkInstance retrieveEncryptionSessionFromMessage:(NSString*)message
                                                                                                       useCache:useCache
@@ -733,7 +1773,7 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
         _SealdInternal_ConvertError(localErr, error);
         return nil;
     }
-    return [SealdEncryptionSession fromMobileSdk:es];
+    return [self _didRetrieveSession:[SealdEncryptionSession fromMobileSdk:es] useCache:useCache];
 }
 
 - (void) retrieveEncryptionSessionAsyncFromMessage:(const NSString*_Nonnull)message
@@ -760,6 +1800,12 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
                                                lookupGroupKey:(const BOOL)lookupGroupKey
                                                         error:(NSError*_Nullable*)error
 {
+    if (useCache && (sessionCache != nil || sessionStore != nil)) {
+        SealdEncryptionSession* stored = [self _cachedSessionWithId:SealdSdkInternalsMobile_sdkParseSessionIdFromFile((NSString*)fileURI, nil)];
+        if (stored != nil) {
+            return stored;
+        }
+    }
     NSError* localErr = nil;
     SealdSdkInternalsMobile_sdkMobileEncryptionSession* es = [sdkInstance retrieveEncryptionSessionFromFile:(NSString*)fileURI
                                                                                                    useCache:useCache
@@ -770,7 +1816,7 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
         _SealdInternal_ConvertError(localErr, error);
         return nil;
     }
-    return [SealdEncryptionSession fromMobileSdk:es];
+    return [self _didRetrieveSession:[SealdEncryptionSession fromMobileSdk:es] useCache:useCache];
 }
 
 - (void) retrieveEncryptionSessionAsyncFromFile:(const NSString*_Nonnull)fileURI
@@ -797,6 +1843,12 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
                                                 lookupGroupKey:(const BOOL)lookupGroupKey
                                                          error:(NSError*_Nullable*)error
 {
+    if (useCache && (sessionCache != nil || sessionStore != nil)) {
+        SealdEncryptionSession* stored = [self _cachedSessionWithId:SealdSdkInternalsMobile_sdkParseSessionIdFromBytes((NSData*)fileBytes, nil)];
+        if (stored != nil) {
+            return stored;
+        }
+    }
     NSError* localErr = nil;
     SealdSdkInternalsMobile_sdkMobileEncryptionSession* es = [sdkInstance retrieveEncryptionSessionFromBytes:(NSData*)fileBytes
                                                                                                     useCache:useCache
@@ -807,7 +1859,7 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
         _SealdInternal_ConvertError(localErr, error);
         return nil;
     }
-    return [SealdEncryptionSession fromMobileSdk:es];
+    return [self _didRetrieveSession:[SealdEncryptionSession fromMobileSdk:es] useCache:useCache];
 }
 
 - (void) retrieveEncryptionSessionAsyncFromBytes:(const NSData*_Nonnull)fileBytes
@@ -836,6 +1888,12 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
                                                   useCache:(const BOOL)useCache
                                                      error:(NSError*_Nullable*)error
 {
+    if (useCache) {
+        SealdEncryptionSession* stored = [self _cachedSessionWithId:(NSString*)sessionId];
+        if (stored != nil) {
+            return stored;
+        }
+    }
     NSError* localErr = nil;
     SealdSdkInternalsMobile_sdkTmrAccessesRetrievalFilters* nativeFilter = [tmrAccessesFilters toMobileSdk];
     SealdSdkInternalsMobile_sdkMobileEncryptionSession* es =
@@ -850,7 +1908,7 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
         _SealdInternal_ConvertError(localErr, error);
         return nil;
     }
-    return [SealdEncryptionSession fromMobileSdk:es];
+    return [self _didRetrieveSession:[SealdEncryptionSession fromMobileSdk:es] useCache:useCache];
 }
 
 - (void) retrieveEncryptionSessionAsyncByTmr:(const NSString*)tmrJWT
@@ -881,9 +1939,27 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
                                                           lookupGroupKey:(const BOOL)lookupGroupKey
                                                                    error:(NSError*_Nullable*)error __attribute__((swift_error(nonnull_error)))
 {
+    NSMutableDictionary<NSString*, SealdEncryptionSession*>* stored = [NSMutableDictionary dictionary];
+    NSMutableArray<NSString*>* missingIds = [NSMutableArray arrayWithCapacity:[sessionIds count]];
+    for (NSString* sessionId in sessionIds) {
+        SealdEncryptionSession* es = useCache ? [self _cachedSessionWithId:sessionId] : nil;
+        if (es != nil) {
+            stored[sessionId] = es;
+        } else {
+            [missingIds addObject:sessionId];
+        }
+    }
+    if ([missingIds count] == 0) {
+        NSMutableArray<SealdEncryptionSession*>* result = [NSMutableArray arrayWithCapacity:[sessionIds count]];
+        for (NSString* sessionId in sessionIds) {
+            [result addObject:stored[sessionId]];
+        }
+        return result;
+    }
+
     NSError* localErr = nil;
     SealdSdkInternalsMobile_sdkMobileEncryptionSessionArray* array =
-        [sdkInstance retrieveMultipleEncryptionSessions:arrayToStringArray((NSArray<NSString*>*)sessionIds)
+        [sdkInstance retrieveMultipleEncryptionSessions:arrayToStringArray(missingIds)
                                                useCache:(BOOL)useCache
                                          lookupProxyKey:(BOOL)lookupProxyKey
                                          lookupGroupKey:(BOOL)lookupGroupKey
@@ -892,7 +1968,20 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
         _SealdInternal_ConvertError(localErr, error);
         return nil;
     }
-    return [SealdEncryptionSession fromMobileSdkArray:array];
+    NSArray<SealdEncryptionSession*>* retrieved = [SealdEncryptionSession fromMobileSdkArray:array];
+    if ([stored count] == 0 && sessionCache == nil && sessionStore == nil) {
+        return retrieved;
+    }
+    for (SealdEncryptionSession* es in retrieved) {
+        stored[es.sessionId] = [self _didRetrieveSession:es useCache:useCache];
+    }
+    NSMutableArray<SealdEncryptionSession*>* result = [NSMutableArray arrayWithCapacity:[sessionIds count]];
+    for (NSString* sessionId in sessionIds) {
+        if (stored[sessionId] != nil) {
+            [result addObject:stored[sessionId]];
+        }
+    }
+    return result;
 }
 
 - (void) retrieveMultipleEncryptionSessionsAsync:(const NSArray<NSString*>*)sessionIds
@@ -925,6 +2014,393 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
     return [SealdEncryptionSession fromMobileSdk:es];
 }
 
+// Bulk
+// Retrieves `sessionIds` in batches, runs `action` on each retrieved session with at most `options.maxConcurrency` in flight,
+// and reports progress after each session. Sessions that cannot be retrieved get a failed status without running `action`.
+// `afterBatch` is called after each batch, for example to save a checkpoint. If it returns `NO`, the remaining batches are skipped.
+- (NSDictionary<NSString*, SealdActionStatus*>*) _bulkOnSessionIds:(const NSArray<NSString*>*)sessionIds
+                                                           options:(const SealdBulkOptions*_Nullable)options
+                                                          progress:(SealdBulkProgressHandler _Nullable)progress
+                                                            action:(SealdActionStatus* (^)(SealdEncryptionSession* es))action
+                                                        afterBatch:(BOOL (^_Nullable)(void))afterBatch
+{
+    SealdBulkOptions* opts = options != nil ? (SealdBulkOptions*)options : [[SealdBulkOptions alloc] init];
+    NSArray<NSString*>* uniqueIds = [[NSOrderedSet orderedSetWithArray:(NSArray<NSString*>*)sessionIds] array];
+    NSInteger total = [uniqueIds count];
+    NSMutableDictionary<NSString*, SealdActionStatus*>* results = [NSMutableDictionary dictionaryWithCapacity:total];
+    __block NSInteger done = 0;
+    void (^record)(NSString*, SealdActionStatus*) = ^(NSString* sessionId, SealdActionStatus* status) {
+        NSInteger doneNow;
+        @synchronized (results) {
+            results[sessionId] = status;
+            doneNow = ++done;
+        }
+        if (progress) {
+            progress(doneNow, total);
+        }
+    };
+
+    NSInteger batchSize = MAX(opts.batchSize, 1);
+    for (NSInteger start = 0; start < total; start += batchSize) {
+        @autoreleasepool {
+            NSArray<NSString*>* batchIds = [uniqueIds subarrayWithRange:NSMakeRange(start, MIN(batchSize, total - start))];
+            NSArray* sessions = [self _retrieveSessionsForBulk:batchIds options:opts record:record];
+            runConcurrently([batchIds count], opts.maxConcurrency, ^(NSInteger i) {
+                if (sessions[i] == [NSNull null]) {
+                    return;
+                }
+                record(batchIds[i], action(sessions[i]));
+            });
+            if (afterBatch && !afterBatch()) {
+                break;
+            }
+        }
+    }
+    return results;
+}
+
+// Returns, for each ID, the retrieved session, or NSNull if it could not be retrieved, in which case its failure is recorded.
+- (NSArray*) _retrieveSessionsForBulk:(NSArray<NSString*>*)sessionIds
+                              options:(SealdBulkOptions*)options
+                               record:(void (^)(NSString* sessionId, SealdActionStatus* status))record
+{
+    NSError* localErr = nil;
+    NSArray<SealdEncryptionSession*>* sessions = [self retrieveMultipleEncryptionSessions:sessionIds
+                                                                                 useCache:options.useCache
+                                                                           lookupProxyKey:options.lookupProxyKey
+                                                                           lookupGroupKey:options.lookupGroupKey
+                                                                                    error:&localErr];
+    if (!localErr && [sessions count] == [sessionIds count]) {
+        return sessions;
+    }
+    // The batch call fails as a whole when any session fails: retry one by one to isolate the failures.
+    NSMutableArray* res = [NSMutableArray arrayWithCapacity:[sessionIds count]];
+    for (NSUInteger i = 0; i < [sessionIds count]; i++) {
+        [res addObject:[NSNull null]];
+    }
+    runConcurrently([sessionIds count], options.maxConcurrency, ^(NSInteger i) {
+        NSError* err = nil;
+        SealdEncryptionSession* es = [self retrieveEncryptionSessionWithSessionId:sessionIds[i]
+                                                                         useCache:options.useCache
+                                                                   lookupProxyKey:options.lookupProxyKey
+                                                                   lookupGroupKey:options.lookupGroupKey
+                                                                            error:&err];
+        if (err) {
+            record(sessionIds[i], [SealdActionStatus statusWithError:err]);
+            return;
+        }
+        @synchronized (res) {
+            res[i] = es;
+        }
+    });
+    return res;
+}
+
+- (NSDictionary<NSString*, SealdActionStatus*>*) addRecipients:(const NSArray<SealdRecipientWithRights*>*)recipients
+                                                  toSessionIds:(const NSArray<NSString*>*)sessionIds
+                                                       options:(const SealdBulkOptions*_Nullable)options
+                                                      progress:(SealdBulkProgressHandler _Nullable)progress
+{
+    return [self _bulkOnSessionIds:sessionIds options:options progress:progress action:^SealdActionStatus*(SealdEncryptionSession* es) {
+        NSError* localErr = nil;
+        NSDictionary<NSString*, SealdActionStatus*>* statuses = [es addRecipients:recipients error:&localErr];
+        if (localErr) {
+            return [SealdActionStatus statusWithError:localErr];
+        }
+        for (NSString* recipientId in statuses) {
+            SealdActionStatus* status = statuses[recipientId];
+            if (!status.success) {
+                return [SealdActionStatus statusWithSuccess:false
+                                                  errorCode:status.errorCode
+                                                     result:[NSString stringWithFormat:@"%@: %@", recipientId, status.result]];
+            }
+        }
+        return [SealdActionStatus statusWithSuccess:true errorCode:@"" result:@""];
+    } afterBatch:nil];
+}
+
+- (void) addRecipientsAsync:(const NSArray<SealdRecipientWithRights*>*)recipients
+               toSessionIds:(const NSArray<NSString*>*)sessionIds
+                    options:(const SealdBulkOptions*_Nullable)options
+                   progress:(SealdBulkProgressHandler _Nullable)progress
+          completionHandler:(void (^)(NSDictionary<NSString*, SealdActionStatus*>* result))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSDictionary<NSString*, SealdActionStatus*>* res = [self addRecipients:recipients
+                                                                  toSessionIds:sessionIds
+                                                                       options:options
+                                                                      progress:progress];
+
+        completionHandler(res);
+    });
+}
+
+- (NSDictionary<NSString*, SealdActionStatus*>*) addProxySession:(const NSString*)proxySessionId
+                                                           rights:(const SealdRecipientRights*_Nullable)rights
+                                                     toSessionIds:(const NSArray<NSString*>*)sessionIds
+                                                          options:(const SealdBulkOptions*_Nullable)options
+                                                         progress:(SealdBulkProgressHandler _Nullable)progress
+{
+    return [self _bulkOnSessionIds:sessionIds options:options progress:progress action:^SealdActionStatus*(SealdEncryptionSession* es) {
+        NSError* localErr = nil;
+        if (rights != nil) {
+            [es addProxySession:proxySessionId rights:rights error:&localErr];
+        } else {
+            [es addProxySession:proxySessionId error:&localErr];
+        }
+        if (localErr) {
+            return [SealdActionStatus statusWithError:localErr];
+        }
+        return [SealdActionStatus statusWithSuccess:true errorCode:@"" result:@""];
+    } afterBatch:nil];
+}
+
+- (void) addProxySessionAsync:(const NSString*)proxySessionId
+                       rights:(const SealdRecipientRights*_Nullable)rights
+                 toSessionIds:(const NSArray<NSString*>*)sessionIds
+                      options:(const SealdBulkOptions*_Nullable)options
+                     progress:(SealdBulkProgressHandler _Nullable)progress
+            completionHandler:(void (^)(NSDictionary<NSString*, SealdActionStatus*>* result))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSDictionary<NSString*, SealdActionStatus*>* res = [self addProxySession:proxySessionId
+                                                                          rights:rights
+                                                                    toSessionIds:sessionIds
+                                                                         options:options
+                                                                        progress:progress];
+
+        completionHandler(res);
+    });
+}
+
+- (SealdBulkTmrAccessesResult*) addMultipleTmrAccesses:(const NSArray<SealdTmrRecipientWithRights*>*)recipients
+                                          toSessionIds:(const NSArray<NSString*>*)sessionIds
+                                               options:(const SealdBulkOptions*_Nullable)options
+                                              progress:(SealdBulkProgressHandler _Nullable)progress
+                                                 error:(NSError*_Nullable*)error
+{
+    // Recipients are converted once, instead of once per session.
+    NSError* localErr = nil;
+    SealdSdkInternalsMobile_sdkTmrRecipientWithRightsArray* nativeRecipients = [SealdTmrRecipientWithRights toMobileSdkArray:(NSArray<SealdTmrRecipientWithRights*>*)recipients error:&localErr];
+    if (localErr) {
+        _SealdInternal_ConvertError(localErr, error);
+        return nil;
+    }
+
+    NSMutableDictionary<NSString*, NSDictionary<NSString*, SealdActionStatus*>*>* recipientsStatuses = [NSMutableDictionary dictionary];
+    NSDictionary<NSString*, SealdActionStatus*>* sessionsStatuses = [self _bulkOnSessionIds:sessionIds options:options progress:progress action:^SealdActionStatus*(SealdEncryptionSession* es) {
+        NSError* err = nil;
+        NSDictionary<NSString*, SealdActionStatus*>* statuses = [es _addMultipleNativeTmrAccesses:nativeRecipients error:&err];
+        if (err) {
+            return [SealdActionStatus statusWithError:err];
+        }
+        @synchronized (recipientsStatuses) {
+            recipientsStatuses[es.sessionId] = statuses;
+        }
+        for (NSString* recipientId in statuses) {
+            SealdActionStatus* status = statuses[recipientId];
+            if (!status.success) {
+                return [SealdActionStatus statusWithSuccess:false
+                                                  errorCode:status.errorCode
+                                                     result:[NSString stringWithFormat:@"%@: %@", recipientId, status.result]];
+            }
+        }
+        return [SealdActionStatus statusWithSuccess:true errorCode:@"" result:@""];
+    } afterBatch:nil];
+    return [[SealdBulkTmrAccessesResult alloc] initWithSessions:sessionsStatuses recipients:recipientsStatuses];
+}
+
+- (void) addMultipleTmrAccessesAsync:(const NSArray<SealdTmrRecipientWithRights*>*)recipients
+                        toSessionIds:(const NSArray<NSString*>*)sessionIds
+                             options:(const SealdBulkOptions*_Nullable)options
+                            progress:(SealdBulkProgressHandler _Nullable)progress
+                   completionHandler:(void (^)(SealdBulkTmrAccessesResult* result, NSError*_Nullable error))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSError* localErr = nil;
+        SealdBulkTmrAccessesResult* res = [self addMultipleTmrAccesses:recipients
+                                                          toSessionIds:sessionIds
+                                                               options:options
+                                                              progress:progress
+                                                                 error:&localErr];
+
+        completionHandler(res, localErr);
+    });
+}
+
+- (NSDictionary<NSString*, SealdActionStatus*>*) setRecipients:(const NSArray<NSString*>*)sealdIds
+                                                        rights:(const SealdRecipientRights*_Nullable)rights
+                                                 forSessionIds:(const NSArray<NSString*>*)sessionIds
+                                                       options:(const SealdBulkOptions*_Nullable)options
+                                                      progress:(SealdBulkProgressHandler _Nullable)progress
+{
+    NSString* currentUserId = [self getCurrentAccountInfo].userId;
+    return [self _bulkOnSessionIds:sessionIds options:options progress:progress action:^SealdActionStatus*(SealdEncryptionSession* es) {
+        NSError* localErr = nil;
+        SealdSetRecipientsResult* res = [es _setRecipients:(NSArray<NSString*>*)sealdIds rights:(SealdRecipientRights*)rights keepingId:currentUserId error:&localErr];
+        if (localErr) {
+            return [SealdActionStatus statusWithError:localErr];
+        }
+        if (res.error != nil) {
+            return [SealdActionStatus statusWithError:res.error];
+        }
+        NSMutableArray<NSDictionary<NSString*, SealdActionStatus*>*>* allStatuses = [NSMutableArray arrayWithObjects:res.added, res.rightsChanged, nil];
+        if (res.revoked != nil) {
+            [allStatuses addObject:res.revoked.recipients];
+        }
+        for (NSDictionary<NSString*, SealdActionStatus*>* statuses in allStatuses) {
+            for (NSString* recipientId in statuses) {
+                SealdActionStatus* status = statuses[recipientId];
+                if (!status.success) {
+                    return [SealdActionStatus statusWithSuccess:false
+                                                      errorCode:status.errorCode
+                                                         result:[NSString stringWithFormat:@"%@: %@", recipientId, status.result]];
+                }
+            }
+        }
+        return [SealdActionStatus statusWithSuccess:true errorCode:@"" result:@""];
+    } afterBatch:nil];
+}
+
+- (void) setRecipientsAsync:(const NSArray<NSString*>*)sealdIds
+                     rights:(const SealdRecipientRights*_Nullable)rights
+              forSessionIds:(const NSArray<NSString*>*)sessionIds
+                    options:(const SealdBulkOptions*_Nullable)options
+                   progress:(SealdBulkProgressHandler _Nullable)progress
+          completionHandler:(void (^)(NSDictionary<NSString*, SealdActionStatus*>* result))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSDictionary<NSString*, SealdActionStatus*>* res = [self setRecipients:sealdIds
+                                                                        rights:rights
+                                                                 forSessionIds:sessionIds
+                                                                       options:options
+                                                                      progress:progress];
+
+        completionHandler(res);
+    });
+}
+
+- (SealdBulkRevokeResult*) revokeRecipientsWithSealdIds:(const NSArray<NSString*>*_Nullable)sealdIds
+                                       proxySessionsIds:(const NSArray<NSString*>*_Nullable)proxySessionsIds
+                                         fromSessionIds:(const NSArray<NSString*>*)sessionIds
+                                                options:(const SealdBulkOptions*_Nullable)options
+                                         checkpointPath:(const NSString*_Nullable)checkpointPath
+                                               progress:(SealdBulkProgressHandler _Nullable)progress
+                                                  error:(NSError*_Nullable*)error
+{
+    NSMutableDictionary<NSString*, SealdRevokeResult*>* revokeResults = [NSMutableDictionary dictionary];
+    NSMutableDictionary<NSString*, id>* checkpointResults = [NSMutableDictionary dictionary];
+    // The checkpoint is bound to the parameters of the operation, so that it cannot be resumed with different recipients or sessions.
+    NSArray* (^sortedUnique)(const NSArray<NSString*>*) = ^NSArray*(const NSArray<NSString*>* ids) {
+        return [[[NSSet setWithArray:(NSArray<NSString*>*)ids ?: @[]] allObjects] sortedArrayUsingSelector:@selector(compare:)];
+    };
+    NSDictionary* checkpointParameters = @{
+        @"sealdIds": sortedUnique(sealdIds),
+        @"proxySessionsIds": sortedUnique(proxySessionsIds),
+        @"sessionIds": sortedUnique(sessionIds)
+    };
+
+    // The checkpoint holds the results of sessions already done, so that a killed operation can be resumed where it stopped.
+    if (checkpointPath != nil && [[NSFileManager defaultManager] fileExistsAtPath:(NSString*)checkpointPath]) {
+        NSError* localErr = nil;
+        NSData* data = [NSData dataWithContentsOfFile:(NSString*)checkpointPath options:0 error:&localErr];
+        NSDictionary* saved = data != nil ? [NSJSONSerialization JSONObjectWithData:data options:0 error:&localErr] : nil;
+        if (localErr) {
+            if (error) *error = localErr;
+            return nil;
+        }
+        if (![saved isKindOfClass:[NSDictionary class]] || ![saved[@"parameters"] isKindOfClass:[NSDictionary class]] || ![saved[@"results"] isKindOfClass:[NSDictionary class]]) {
+            _SealdInternal_SetError(@"INVALID_CHECKPOINT", @"The checkpoint file is not a valid bulk revocation checkpoint", error);
+            return nil;
+        }
+        if (![saved[@"parameters"] isEqualToDictionary:checkpointParameters]) {
+            _SealdInternal_SetError(@"CHECKPOINT_MISMATCH", @"The checkpoint file was saved by a bulk revocation with different recipients or sessions", error);
+            return nil;
+        }
+        NSDictionary* savedResults = saved[@"results"];
+        [checkpointResults addEntriesFromDictionary:savedResults];
+        for (NSString* sessionId in savedResults) {
+            revokeResults[sessionId] = [SealdRevokeResult fromDictionary:savedResults[sessionId]];
+        }
+    }
+
+    NSMutableArray<NSString*>* remainingIds = [NSMutableArray arrayWithCapacity:[sessionIds count]];
+    for (NSString* sessionId in sessionIds) {
+        if (revokeResults[sessionId] == nil) {
+            [remainingIds addObject:sessionId];
+        }
+    }
+
+    __block NSError* checkpointErr = nil;
+    NSDictionary<NSString*, SealdActionStatus*>* statuses = [self _bulkOnSessionIds:remainingIds options:options progress:progress action:^SealdActionStatus*(SealdEncryptionSession* es) {
+        NSError* localErr = nil;
+        SealdRevokeResult* res = [es revokeRecipientsWithSealdIds:sealdIds
+                                                 proxySessionsIds:proxySessionsIds
+                                                    symEncKeysIds:nil
+                                                     tmrAccessIds:nil
+                                             tmrAccessAuthFactors:nil
+                                                            error:&localErr];
+        if (localErr) {
+            return [SealdActionStatus statusWithError:localErr];
+        }
+        @synchronized (revokeResults) {
+            revokeResults[es.sessionId] = res;
+            checkpointResults[es.sessionId] = [res toDictionary];
+        }
+        return [SealdActionStatus statusWithSuccess:true errorCode:@"" result:@""];
+    } afterBatch:^BOOL {
+        if (checkpointPath == nil) {
+            return YES;
+        }
+        // Going on without a checkpoint would make the operation impossible to resume: stop at the first failed write.
+        NSError* localErr = nil;
+        NSData* data = [NSJSONSerialization dataWithJSONObject:@{@"parameters": checkpointParameters, @"results": checkpointResults} options:0 error:&localErr];
+        if (data != nil) {
+            [data writeToFile:(NSString*)checkpointPath options:NSDataWritingAtomic | NSDataWritingFileProtectionCompleteUntilFirstUserAuthentication error:&localErr];
+        }
+        checkpointErr = localErr;
+        return checkpointErr == nil;
+    }];
+    if (checkpointErr) {
+        if (error) *error = checkpointErr;
+        return nil;
+    }
+
+    NSMutableDictionary<NSString*, SealdActionStatus*>* failedSessions = [NSMutableDictionary dictionary];
+    for (NSString* sessionId in statuses) {
+        if (!statuses[sessionId].success) {
+            failedSessions[sessionId] = statuses[sessionId];
+        }
+    }
+    // Once everything is done, the checkpoint is not needed anymore. If some sessions failed, it is kept so that a new call only retries them.
+    if (checkpointPath != nil && [failedSessions count] == 0) {
+        [[NSFileManager defaultManager] removeItemAtPath:(NSString*)checkpointPath error:nil];
+    }
+    return [[SealdBulkRevokeResult alloc] initWithRevokeResults:revokeResults failedSessions:failedSessions];
+}
+
+- (void) revokeRecipientsAsyncWithSealdIds:(const NSArray<NSString*>*_Nullable)sealdIds
+                          proxySessionsIds:(const NSArray<NSString*>*_Nullable)proxySessionsIds
+                            fromSessionIds:(const NSArray<NSString*>*)sessionIds
+                                   options:(const SealdBulkOptions*_Nullable)options
+                            checkpointPath:(const NSString*_Nullable)checkpointPath
+                                  progress:(SealdBulkProgressHandler _Nullable)progress
+                         completionHandler:(void (^)(SealdBulkRevokeResult* result, NSError*_Nullable error))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSError* localErr = nil;
+        SealdBulkRevokeResult* res = [self revokeRecipientsWithSealdIds:sealdIds
+                                                       proxySessionsIds:proxySessionsIds
+                                                         fromSessionIds:sessionIds
+                                                                options:options
+                                                         checkpointPath:checkpointPath
+                                                               progress:progress
+                                                                  error:&localErr];
+
+        completionHandler(res, localErr);
+    });
+}
+
 // Connectors
 - (NSArray<NSString*>*) getSealdIdsFromConnectors:(const NSArray<SealdConnectorTypeValue*>*)connectorTypeValues
                                             error:(NSError*_Nullable*)error
@@ -972,6 +2448,168 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
     });
 }
 
+// Looks up the Seald ID of each of `connectors`, which must be distinct, and caches the results.
+// Returns, for each connector key, its Seald ID or the error that says it is unknown, or `nil` if the lookup failed for another reason.
+- (NSDictionary<NSString*, id>*) _resolveConnectors:(NSArray<SealdConnectorTypeValue*>*)connectors
+                                              error:(NSError*_Nullable*)error
+{
+    NSMutableDictionary<NSString*, id>* res = [NSMutableDictionary dictionaryWithCapacity:[connectors count]];
+    NSError* localErr = nil;
+    SealdSdkInternalsMobile_sdkStringArray* batch = [sdkInstance getSealdIdsFromConnectors:[SealdConnectorTypeValue toMobileSdkArray:connectors] error:&localErr];
+    if (!localErr) {
+        NSArray<NSString*>* sealdIds = stringArrayToArray(batch);
+        if ([sealdIds count] == [connectors count]) {
+            for (NSUInteger i = 0; i < [connectors count]; i++) {
+                NSString* key = [SealdConnectorCache keyForType:connectors[i].type value:connectors[i].value];
+                res[key] = sealdIds[i];
+                [connectorCache setSealdId:sealdIds[i] forConnectorKey:key];
+            }
+            return res;
+        }
+    } else {
+        NSError* convertedErr = nil;
+        _SealdInternal_ConvertError(localErr, &convertedErr);
+        if (!isUnknownConnectorError(convertedErr)) {
+            if (error) *error = convertedErr;
+            return nil;
+        }
+    }
+
+    // The batch does not say which connectors are unknown, nor which Seald ID goes with which connector
+    // when some connectors have none: look them up one by one.
+    __block NSError* failure = nil;
+    runConcurrently([connectors count], defaultMaxConcurrency, ^(NSInteger i) {
+        SealdConnectorTypeValue* connector = connectors[i];
+        NSString* key = [SealdConnectorCache keyForType:connector.type value:connector.value];
+        NSError* oneErr = nil;
+        SealdSdkInternalsMobile_sdkStringArray* one = [self->sdkInstance getSealdIdsFromConnectors:[SealdConnectorTypeValue toMobileSdkArray:@[connector]] error:&oneErr];
+        NSError* convertedErr = nil;
+        _SealdInternal_ConvertError(oneErr, &convertedErr);
+        NSArray<NSString*>* sealdIds = oneErr ? nil : stringArrayToArray(one);
+        @synchronized (res) {
+            if ([sealdIds count] == 1) {
+                res[key] = sealdIds[0];
+                [self->connectorCache setSealdId:sealdIds[0] forConnectorKey:key];
+            } else if (convertedErr != nil && isUnknownConnectorError(convertedErr)) {
+                res[key] = convertedErr;
+                [self->connectorCache setUnknownConnectorKey:key error:convertedErr];
+            } else if (failure == nil) {
+                failure = convertedErr;
+                if (failure == nil) {
+                    NSString* description = [NSString stringWithFormat:@"Unexpected number of Seald IDs for connector %@", key];
+                    _SealdInternal_SetError(@"UNEXPECTED_CONNECTOR_LOOKUP", description, &failure);
+                }
+            }
+        }
+    });
+    if (failure) {
+        if (error) *error = failure;
+        return nil;
+    }
+    return res;
+}
+
+- (NSArray<NSString*>*) getSealdIdsFromConnectors:(const NSArray<SealdConnectorTypeValue*>*)connectorTypeValues
+                                         useCache:(const BOOL)useCache
+                                            error:(NSError*_Nullable*)error
+{
+    if (!useCache || connectorCache == nil) {
+        return [self getSealdIdsFromConnectors:connectorTypeValues error:error];
+    }
+
+    NSMutableDictionary<NSString*, id>* known = [NSMutableDictionary dictionaryWithCapacity:[connectorTypeValues count]];
+    NSMutableDictionary<NSString*, SealdConnectorTypeValue*>* misses = [NSMutableDictionary dictionary];
+    for (SealdConnectorTypeValue* connector in connectorTypeValues) {
+        NSString* key = [SealdConnectorCache keyForType:connector.type value:connector.value];
+        if (known[key] != nil || misses[key] != nil) {
+            continue;
+        }
+        NSError* unknownErr = nil;
+        id sealdId = [connectorCache sealdIdForConnectorKey:key unknownError:&unknownErr];
+        if (sealdId == nil) {
+            misses[key] = connector;
+        } else {
+            known[key] = unknownErr ?: sealdId;
+        }
+    }
+
+    if ([misses count] > 0) {
+        NSError* localErr = nil;
+        NSDictionary<NSString*, id>* resolved = [self _resolveConnectors:[misses allValues] error:&localErr];
+        if (localErr) {
+            if (error) *error = localErr;
+            return nil;
+        }
+        [known addEntriesFromDictionary:resolved];
+    }
+
+    NSMutableArray<NSString*>* res = [NSMutableArray arrayWithCapacity:[connectorTypeValues count]];
+    for (SealdConnectorTypeValue* connector in connectorTypeValues) {
+        id value = known[[SealdConnectorCache keyForType:connector.type value:connector.value]];
+        if ([value isKindOfClass:[NSError class]]) {
+            if (error) *error = value;
+            return nil;
+        }
+        [res addObject:value];
+    }
+    return res;
+}
+
+- (void) getSealdIdsAsyncFromConnectors:(const NSArray<SealdConnectorTypeValue*>*)connectorTypeValues
+                               useCache:(const BOOL)useCache
+                      completionHandler:(void (^)(NSArray<NSString*>* sealdIds, NSError* error))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSError* localErr = nil;
+        NSArray<NSString*>* res = [self getSealdIdsFromConnectors:connectorTypeValues useCache:useCache error:&localErr];
+
+        completionHandler(res, localErr);
+    });
+}
+
+- (NSArray<SealdConnector*>*) getConnectorsFromSealdId:(const NSString*)sealdId
+                                              useCache:(const BOOL)useCache
+                                                 error:(NSError*_Nullable*)error
+{
+    if (!useCache || connectorCache == nil) {
+        return [self getConnectorsFromSealdId:sealdId error:error];
+    }
+    NSArray<SealdConnector*>* cached = [connectorCache connectorsForSealdId:(NSString*)sealdId];
+    if (cached != nil) {
+        return cached;
+    }
+    NSError* localErr = nil;
+    NSArray<SealdConnector*>* res = [self getConnectorsFromSealdId:sealdId error:&localErr];
+    if (localErr) {
+        if (error) *error = localErr;
+        return nil;
+    }
+    [connectorCache setConnectors:res forSealdId:(NSString*)sealdId];
+    return res;
+}
+
+- (void) getConnectorsAsyncFromSealdId:(const NSString*)sealdId
+                              useCache:(const BOOL)useCache
+                     completionHandler:(void (^)(NSArray<SealdConnector*>* connectors, NSError* error))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSError* localErr = nil;
+        NSArray<SealdConnector*>* res = [self getConnectorsFromSealdId:sealdId useCache:useCache error:&localErr];
+
+        completionHandler(res, localErr);
+    });
+}
+
+- (void) seedConnectorsCacheWithConnectors:(const NSArray<SealdConnector*>*)connectors
+{
+    [connectorCache seedWithConnectors:(NSArray<SealdConnector*>*)connectors];
+}
+
+- (void) clearConnectorsCache
+{
+    [connectorCache removeAll];
+}
+
 
 - (SealdConnector*) addConnectorWithValue:(const NSString*)value
                             connectorType:(const NSString*)connectorType
@@ -987,6 +2625,7 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
         _SealdInternal_ConvertError(localErr, error);
         return nil;
     }
+    [connectorCache removeAll];
     return [SealdConnector fromMobileSdk:res];
 }
 
@@ -1015,6 +2654,7 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
         _SealdInternal_ConvertError(localErr, error);
         return nil;
     }
+    [connectorCache removeAll];
     return [SealdConnector fromMobileSdk:res];
 }
 
@@ -1039,6 +2679,7 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
         _SealdInternal_ConvertError(localErr, error);
         return nil;
     }
+    [connectorCache removeAll];
     return [SealdConnector fromMobileSdk:res];
 }
 
@@ -1061,7 +2702,9 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
         _SealdInternal_ConvertError(localErr, error);
         return nil;
     }
-    return [SealdConnector fromMobileSdkArray:res];
+    NSArray<SealdConnector*>* connectors = [SealdConnector fromMobileSdkArray:res];
+    [connectorCache seedWithConnectors:connectors];
+    return connectors;
 }
 
 - (void) listConnectorsAsyncWithCompletionHandler:(void (^)(NSArray<SealdConnector*>* connectors, NSError* error))completionHandler
@@ -1127,6 +2770,38 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
     });
 }
 
+- (SealdMassReencryptDevicesResult*) massReencryptWithDeviceIds:(const NSArray<NSString*>*)deviceIds
+                                                        options:(const SealdMassReencryptOptions*_Nullable)options
+{
+    NSArray<NSString*>* uniqueDeviceIds = [[NSOrderedSet orderedSetWithArray:(NSArray<NSString*>*)deviceIds] array];
+    NSInteger concurrency = options != nil ? options.concurrency : [[SealdMassReencryptOptions alloc] init].concurrency;
+    NSMutableDictionary<NSString*, SealdMassReencryptResponse*>* responses = [NSMutableDictionary dictionary];
+    NSMutableDictionary<NSString*, SealdActionStatus*>* errors = [NSMutableDictionary dictionary];
+    runConcurrently([uniqueDeviceIds count], concurrency, ^(NSInteger i) {
+        NSError* localErr = nil;
+        SealdMassReencryptResponse* res = [self massReencryptWithDeviceId:uniqueDeviceIds[i] options:options error:&localErr];
+        @synchronized (responses) {
+            if (localErr) {
+                errors[uniqueDeviceIds[i]] = [SealdActionStatus statusWithError:localErr];
+            } else {
+                responses[uniqueDeviceIds[i]] = res;
+            }
+        }
+    });
+    return [[SealdMassReencryptDevicesResult alloc] initWithResponses:responses errors:errors];
+}
+
+- (void) massReencryptAsyncWithDeviceIds:(const NSArray<NSString*>*)deviceIds
+                                 options:(const SealdMassReencryptOptions*_Nullable)options
+                       completionHandler:(void (^)(SealdMassReencryptDevicesResult* result))completionHandler
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        SealdMassReencryptDevicesResult* res = [self massReencryptWithDeviceIds:deviceIds options:options];
+
+        completionHandler(res);
+    });
+}
+
 - (NSArray<SealdDeviceMissingKeys*>*) devicesMissingKeysWithForceLocalAccountUpdate:(const BOOL)forceLocalAccountUpdate
                                                                               error:(NSError*_Nullable*)error
 {
@@ -1150,6 +2825,161 @@ __attribute__((constructor)) static void initializeSealdSdkVersion(void) {
     });
 }
 
+// One pass of the key provisioning service: provisions each device still missing keys after its stagger delay.
+// Waits are scheduled on `queue` with dispatch_after, so that no thread is held while waiting. `completion` is called on `queue`.
+- (void) _provisionMissingKeysWithOptions:(SealdKeyProvisioningOptions*)options
+                    forceLocalAccountUpdate:(BOOL)forceLocalAccountUpdate
+                                      queue:(dispatch_queue_t)queue
+                        onDeviceProvisioned:(void (^_Nullable)(NSString* deviceId, SealdMassReencryptResponse*_Nullable response, NSError*_Nullable error))onDeviceProvisioned
+                                onPassError:(void (^_Nullable)(NSError* error))onPassError
+                                  isStopped:(BOOL (^)(void))isStopped
+                                 completion:(void (^)(void))completion
+{
+    NSError* localErr = nil;
+    NSArray<SealdDeviceMissingKeys*>* devices = [self devicesMissingKeysWithForceLocalAccountUpdate:forceLocalAccountUpdate error:&localErr];
+    if (localErr) {
+        if (onPassError) {
+            onPassError(localErr);
+        }
+        completion();
+        return;
+    }
+    NSString* currentDeviceId = [self getCurrentAccountInfo].deviceId;
+    NSMutableArray<NSString*>* deviceIds = [NSMutableArray arrayWithCapacity:[devices count]];
+    for (SealdDeviceMissingKeys* device in devices) {
+        if (![device.deviceId isEqualToString:currentDeviceId]) {
+            [deviceIds addObject:device.deviceId];
+        }
+    }
+    [self _provisionDeviceAtIndex:0 of:deviceIds currentDeviceId:currentDeviceId options:options queue:queue onDeviceProvisioned:onDeviceProvisioned onPassError:onPassError isStopped:isStopped completion:completion];
+}
+
+// Provisions `deviceIds[index]` after its stagger delay if it is still missing keys, then the next device after `options.minTimeBetweenReencryptions`.
+- (void) _provisionDeviceAtIndex:(NSUInteger)index
+                              of:(NSArray<NSString*>*)deviceIds
+                 currentDeviceId:(NSString*)currentDeviceId
+                         options:(SealdKeyProvisioningOptions*)options
+                           queue:(dispatch_queue_t)queue
+             onDeviceProvisioned:(void (^_Nullable)(NSString* deviceId, SealdMassReencryptResponse*_Nullable response, NSError*_Nullable error))onDeviceProvisioned
+                     onPassError:(void (^_Nullable)(NSError* error))onPassError
+                       isStopped:(BOOL (^)(void))isStopped
+                      completion:(void (^)(void))completion
+{
+    if (index >= [deviceIds count] || isStopped()) {
+        completion();
+        return;
+    }
+    NSString* deviceId = deviceIds[index];
+    // Devices sort themselves by a hash of both IDs: the first one to wake up does the work, the others find no keys missing anymore.
+    NSTimeInterval stagger = 0;
+    if (options.maxStagger > 0) {
+        double slot = (double)(stableHash([NSString stringWithFormat:@"%@|%@", currentDeviceId, deviceId]) % 1000) / 1000;
+        double jitter = (double)arc4random_uniform(1000) / 1000 * 0.1;
+        stagger = options.maxStagger * MIN(slot + jitter, 1);
+    }
+    __weak SealdSdk* weakSelf = self;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(stagger * NSEC_PER_SEC)), queue, ^{
+        SealdSdk* strongSelf = weakSelf;
+        if (strongSelf == nil || isStopped()) {
+            completion();
+            return;
+        }
+        // Another device may have provisioned this one during the stagger delay: check again before re-encrypting.
+        NSError* localErr = nil;
+        NSArray<SealdDeviceMissingKeys*>* stillMissing = [strongSelf devicesMissingKeysWithForceLocalAccountUpdate:NO error:&localErr];
+        if (localErr) {
+            if (onPassError) {
+                onPassError(localErr);
+            }
+            completion();
+            return;
+        }
+        BOOL isStillMissing = NO;
+        for (SealdDeviceMissingKeys* d in stillMissing) {
+            if ([d.deviceId isEqualToString:deviceId]) {
+                isStillMissing = YES;
+                break;
+            }
+        }
+        NSTimeInterval pause = 0;
+        if (isStillMissing) {
+            SealdMassReencryptResponse* res = [strongSelf massReencryptWithDeviceId:deviceId options:options.reencryptOptions error:&localErr];
+            if (onDeviceProvisioned) {
+                onDeviceProvisioned(deviceId, res, localErr);
+            }
+            pause = options.minTimeBetweenReencryptions;
+        }
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(pause * NSEC_PER_SEC)), queue, ^{
+            SealdSdk* sdk = weakSelf;
+            if (sdk == nil) {
+                completion();
+                return;
+            }
+            [sdk _provisionDeviceAtIndex:index + 1 of:deviceIds currentDeviceId:currentDeviceId options:options queue:queue onDeviceProvisioned:onDeviceProvisioned onPassError:onPassError isStopped:isStopped completion:completion];
+        });
+    });
+}
+
+- (void) startKeyProvisioningWithOptions:(const SealdKeyProvisioningOptions*_Nullable)options
+                     onDeviceProvisioned:(void (^_Nullable)(NSString* deviceId, SealdMassReencryptResponse*_Nullable response, NSError*_Nullable error))onDeviceProvisioned
+                             onPassError:(void (^_Nullable)(NSError* error))onPassError
+                                   error:(NSError*_Nullable*)error
+{
+    SealdKeyProvisioningOptions* provisioningOptions = options != nil ? (SealdKeyProvisioningOptions*)options : [[SealdKeyProvisioningOptions alloc] init];
+    // A timer with a zero interval would fire continuously.
+    if (!(provisioningOptions.pollInterval > 0)) {
+        _SealdInternal_SetError(@"INVALID_INTERVAL", @"The poll interval must be greater than 0", error);
+        return;
+    }
+    [self stopKeyProvisioning];
+    dispatch_queue_t queue = dispatch_queue_create("io.seald.SealdSdk.keyProvisioning", dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_BACKGROUND, 0));
+    dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, queue);
+    dispatch_source_set_timer(timer, dispatch_time(DISPATCH_TIME_NOW, 0), (uint64_t)(provisioningOptions.pollInterval * NSEC_PER_SEC), (uint64_t)(provisioningOptions.pollInterval * NSEC_PER_SEC / 10));
+    __weak SealdSdk* weakSelf = self;
+    __weak dispatch_source_t weakTimer = timer;
+    // Both are only used on `queue`.
+    __block BOOL isFirstPoll = YES;
+    __block BOOL isPassRunning = NO;
+    dispatch_source_set_event_handler(timer, ^{
+        SealdSdk* strongSelf = weakSelf;
+        if (strongSelf == nil || isPassRunning) {
+            return;
+        }
+        // Only the first poll pays for a full account refresh: later polls rely on the local account, which other calls keep up to date.
+        BOOL forceLocalAccountUpdate = isFirstPoll;
+        isFirstPoll = NO;
+        isPassRunning = YES;
+        [strongSelf _provisionMissingKeysWithOptions:provisioningOptions
+                              forceLocalAccountUpdate:forceLocalAccountUpdate
+                                                queue:queue
+                                  onDeviceProvisioned:onDeviceProvisioned
+                                          onPassError:onPassError
+                                            isStopped:^BOOL {
+            dispatch_source_t t = weakTimer;
+            return t == nil || dispatch_source_testcancel(t) != 0;
+        }
+                                           completion:^{
+            isPassRunning = NO;
+        }];
+    });
+    @synchronized (self) {
+        keyProvisioningTimer = timer;
+    }
+    dispatch_resume(timer);
+}
+
+- (void) stopKeyProvisioning
+{
+    dispatch_source_t timer = nil;
+    @synchronized (self) {
+        timer = keyProvisioningTimer;
+        keyProvisioningTimer = nil;
+    }
+    if (timer != nil) {
+        dispatch_source_cancel(timer);
+    }
+}
+
 - (SealdGetSigchainResponse*) getSigchainHashWithUserId:(const NSString*)userId
                                                position:(const NSInteger)position
                                                   error:(NSError*_Nullable*)error
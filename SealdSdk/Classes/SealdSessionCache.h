@@ -0,0 +1,69 @@
+//
+//  SealdSessionCache.h
+//  SealdSdk
+//
+//  Created by Seald SAS on 18/10/2026.
+//  Copyright © 2026 Seald SAS. All rights reserved.
+//
+
+#ifndef SealdSessionCache_h
+#define SealdSessionCache_h
+
+#import <Foundation/Foundation.h>
+#import "SealdEncryptionSession.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** \cond */
+/**
+ * SealdSessionCache keeps ready-to-use encryption sessions in memory, so that repeated retrievals
+ * do not pay the native lookup and object creation again. Unpinned and pinned sessions have separate budgets:
+ * when it holds more than `maxEntries` unpinned sessions, the least recently used ones are evicted,
+ * and pinning fails once `maxPinnedEntries` sessions are pinned. Pinned sessions are never evicted.
+ * Entries expire after `defaultTTL`, or after the TTL set for their session ID. Pinned entries only expire if they have their own TTL.
+ * Used by SealdSdk when SealdSdkOptions.sessionCacheMaxEntries is set.
+ */
+@interface SealdSessionCache : NSObject
+@property (atomic, assign, readonly) NSInteger maxEntries;
+@property (atomic, assign, readonly) NSInteger maxPinnedEntries;
+/** `-1` for entries to never expire, `0` to not cache unpinned sessions without their own TTL. */
+@property (atomic, assign, readonly) NSTimeInterval defaultTTL;
+/** The number of sessions currently cached, pinned or not. */
+@property (atomic, assign, readonly) NSInteger count;
+/** The number of pinned sessions currently cached. */
+@property (atomic, assign, readonly) NSInteger pinnedCount;
+/** Entries removed because they expired, since the last resetCounters. */
+@property (atomic, assign, readonly) NSInteger expiredEvictions;
+/** Entries evicted to stay within `maxEntries`, since the last resetCounters. */
+@property (atomic, assign, readonly) NSInteger capacityEvictions;
+/** Entries removed with removeSessionWithId: or removeAllSessions, since the last resetCounters. */
+@property (atomic, assign, readonly) NSInteger invalidations;
+- (instancetype) initWithMaxEntries:(NSInteger)maxEntries
+                   maxPinnedEntries:(NSInteger)maxPinnedEntries
+                         defaultTTL:(NSTimeInterval)defaultTTL;
+/** Returns the cached session and marks it as recently used, or `nil` if it is not cached or has expired. */
+- (nullable SealdEncryptionSession*) sessionWithId:(NSString*)sessionId;
+/** Whether the session is cached and has not expired, without marking it as recently used. */
+- (BOOL) containsSessionWithId:(NSString*)sessionId;
+- (void) setSession:(SealdEncryptionSession*)session;
+- (void) removeSessionWithId:(NSString*)sessionId;
+- (void) removeAllSessions;
+/** Pins apply to the session ID, whether the session is cached yet or not. Returns `NO` if `maxPinnedEntries` sessions are already pinned. */
+- (BOOL) setPinned:(BOOL)pinned
+  forSessionWithId:(NSString*)sessionId;
+/** Overrides `defaultTTL` for one session ID, whether the session is cached yet or not. The TTL of a cached entry is counted again from now. */
+- (void) setTTL:(NSTimeInterval)ttl
+forSessionWithId:(NSString*)sessionId;
+/** Reverts the session ID to `defaultTTL`. */
+- (void) removeTTLForSessionWithId:(NSString*)sessionId;
+/** The TTL that applies to the session ID: its own, or `defaultTTL` if it is unpinned, or `-1` if it is pinned. */
+- (NSTimeInterval) ttlForSessionWithId:(NSString*)sessionId;
+/** Describes the cached sessions that have not expired. */
+- (NSArray<SealdCacheEntryInfo*>*) entriesInfo;
+- (void) resetCounters;
+@end
+/** \endcond */
+
+NS_ASSUME_NONNULL_END
+
+#endif /* SealdSessionCache_h */
@@ -0,0 +1,261 @@
+//
+//  SealdSessionCache.m
+//  SealdSdk
+//
+//  Created by Seald SAS on 18/10/2026.
+//  Copyright © 2026 Seald SAS. All rights reserved.
+//
+
+#import "SealdSessionCache.h"
+
+@interface SealdSessionCacheEntry : NSObject
+@property (nonatomic, strong) SealdEncryptionSession* session;
+/** `nil` if the entry never expires. */
+@property (nonatomic, strong, nullable) NSDate* expiresAt;
+@end
+
+@implementation SealdSessionCacheEntry
+@end
+
+@implementation SealdSessionCache {
+    NSMutableDictionary<NSString*, SealdSessionCacheEntry*>* entries;
+    // Unpinned cached session IDs, least recently used first.
+    NSMutableOrderedSet<NSString*>* lru;
+    NSMutableSet<NSString*>* pinnedIds;
+    NSMutableDictionary<NSString*, NSNumber*>* ttlOverrides;
+    NSInteger expiredEvictionsCount;
+    NSInteger capacityEvictionsCount;
+    NSInteger invalidationsCount;
+}
+
+- (instancetype) initWithMaxEntries:(NSInteger)maxEntries
+                   maxPinnedEntries:(NSInteger)maxPinnedEntries
+                         defaultTTL:(NSTimeInterval)defaultTTL
+{
+    self = [super init];
+    if (self) {
+        _maxEntries = maxEntries;
+        _maxPinnedEntries = maxPinnedEntries;
+        _defaultTTL = defaultTTL;
+        entries = [NSMutableDictionary dictionaryWithCapacity:maxEntries];
+        lru = [NSMutableOrderedSet orderedSetWithCapacity:maxEntries];
+        pinnedIds = [NSMutableSet set];
+        ttlOverrides = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+- (NSInteger) count
+{
+    @synchronized (self) {
+        return [entries count];
+    }
+}
+
+// Must be called while holding the lock on `self`.
+// Returns the TTL that applies to `sessionId`: its own, or `defaultTTL` if it is unpinned, or `-1` if it is pinned.
+- (NSTimeInterval) _ttlForSessionId:(NSString*)sessionId
+{
+    NSNumber* override = ttlOverrides[sessionId];
+    if (override != nil) {
+        return [override doubleValue];
+    }
+    return [pinnedIds containsObject:sessionId] ? -1 : self.defaultTTL;
+}
+
+// Must be called while holding the lock on `self`.
+// Returns the entry if it has not expired, and removes it otherwise.
+- (SealdSessionCacheEntry*) _liveEntryForSessionId:(NSString*)sessionId
+{
+    SealdSessionCacheEntry* entry = entries[sessionId];
+    if (entry != nil && entry.expiresAt != nil && [entry.expiresAt timeIntervalSinceNow] <= 0) {
+        [entries removeObjectForKey:sessionId];
+        [lru removeObject:sessionId];
+        expiredEvictionsCount++;
+        return nil;
+    }
+    return entry;
+}
+
+- (nullable SealdEncryptionSession*) sessionWithId:(NSString*)sessionId
+{
+    @synchronized (self) {
+        SealdSessionCacheEntry* entry = [self _liveEntryForSessionId:sessionId];
+        if (entry != nil && ![pinnedIds containsObject:sessionId]) {
+            [lru removeObject:sessionId];
+            [lru addObject:sessionId];
+        }
+        return entry.session;
+    }
+}
+
+- (BOOL) containsSessionWithId:(NSString*)sessionId
+{
+    @synchronized (self) {
+        return [self _liveEntryForSessionId:sessionId] != nil;
+    }
+}
+
+- (void) setSession:(SealdEncryptionSession*)session
+{
+    NSString* sessionId = session.sessionId;
+    @synchronized (self) {
+        NSTimeInterval ttl = [self _ttlForSessionId:sessionId];
+        if (ttl == 0) {
+            [entries removeObjectForKey:sessionId];
+            [lru removeObject:sessionId];
+            return;
+        }
+        SealdSessionCacheEntry* entry = [[SealdSessionCacheEntry alloc] init];
+        entry.session = session;
+        entry.expiresAt = ttl < 0 ? nil : [NSDate dateWithTimeIntervalSinceNow:ttl];
+        entries[sessionId] = entry;
+        if ([pinnedIds containsObject:sessionId]) {
+            return;
+        }
+        [lru removeObject:sessionId];
+        [lru addObject:sessionId];
+        while ((NSInteger)[lru count] > self.maxEntries) {
+            [entries removeObjectForKey:lru[0]];
+            [lru removeObjectAtIndex:0];
+            capacityEvictionsCount++;
+        }
+    }
+}
+
+- (void) removeSessionWithId:(NSString*)sessionId
+{
+    @synchronized (self) {
+        if (entries[sessionId] != nil) {
+            invalidationsCount++;
+        }
+        [entries removeObjectForKey:sessionId];
+        [lru removeObject:sessionId];
+    }
+}
+
+- (void) removeAllSessions
+{
+    @synchronized (self) {
+        invalidationsCount += [entries count];
+        [entries removeAllObjects];
+        [lru removeAllObjects];
+    }
+}
+
+- (NSInteger) pinnedCount
+{
+    @synchronized (self) {
+        NSInteger res = 0;
+        for (NSString* sessionId in pinnedIds) {
+            if (entries[sessionId] != nil) {
+                res++;
+            }
+        }
+        return res;
+    }
+}
+
+- (NSInteger) expiredEvictions
+{
+    @synchronized (self) {
+        return expiredEvictionsCount;
+    }
+}
+
+- (NSInteger) capacityEvictions
+{
+    @synchronized (self) {
+        return capacityEvictionsCount;
+    }
+}
+
+- (NSInteger) invalidations
+{
+    @synchronized (self) {
+        return invalidationsCount;
+    }
+}
+
+- (void) resetCounters
+{
+    @synchronized (self) {
+        expiredEvictionsCount = 0;
+        capacityEvictionsCount = 0;
+        invalidationsCount = 0;
+    }
+}
+
+- (NSArray<SealdCacheEntryInfo*>*) entriesInfo
+{
+    @synchronized (self) {
+        NSMutableArray<SealdCacheEntryInfo*>* res = [NSMutableArray arrayWithCapacity:[entries count]];
+        for (NSString* sessionId in [entries allKeys]) {
+            SealdSessionCacheEntry* entry = [self _liveEntryForSessionId:sessionId];
+            if (entry == nil) {
+                continue;
+            }
+            [res addObject:[[SealdCacheEntryInfo alloc] initWithSessionId:sessionId
+                                                         retrievalDetails:entry.session.retrievalDetails
+                                                                   pinned:[pinnedIds containsObject:sessionId]
+                                                                expiresAt:entry.expiresAt]];
+        }
+        return res;
+    }
+}
+
+- (BOOL) setPinned:(BOOL)pinned
+  forSessionWithId:(NSString*)sessionId
+{
+    @synchronized (self) {
+        if ([pinnedIds containsObject:sessionId] == pinned) {
+            return YES;
+        }
+        if (pinned) {
+            if ((NSInteger)[pinnedIds count] >= self.maxPinnedEntries) {
+                return NO;
+            }
+            [pinnedIds addObject:sessionId];
+            [lru removeObject:sessionId];
+        } else {
+            [pinnedIds removeObject:sessionId];
+        }
+        // Re-insert the cached session, so that its TTL and its place in the LRU follow its new pin state.
+        SealdSessionCacheEntry* entry = [self _liveEntryForSessionId:sessionId];
+        if (entry != nil) {
+            [self setSession:entry.session];
+        }
+        return YES;
+    }
+}
+
+- (void) setTTL:(NSTimeInterval)ttl
+forSessionWithId:(NSString*)sessionId
+{
+    @synchronized (self) {
+        ttlOverrides[sessionId] = @(ttl);
+        SealdSessionCacheEntry* entry = [self _liveEntryForSessionId:sessionId];
+        if (entry != nil) {
+            [self setSession:entry.session];
+        }
+    }
+}
+
+- (void) removeTTLForSessionWithId:(NSString*)sessionId
+{
+    @synchronized (self) {
+        [ttlOverrides removeObjectForKey:sessionId];
+        SealdSessionCacheEntry* entry = [self _liveEntryForSessionId:sessionId];
+        if (entry != nil) {
+            [self setSession:entry.session];
+        }
+    }
+}
+
+- (NSTimeInterval) ttlForSessionWithId:(NSString*)sessionId
+{
+    @synchronized (self) {
+        return [self _ttlForSessionId:sessionId];
+    }
+}
+@end
@@ -0,0 +1,85 @@
+//
+//  SealdSessionStore.h
+//  SealdSdk
+//
+//  Created by Seald SAS on 18/10/2026.
+//  Copyright © 2026 Seald SAS. All rights reserved.
+//
+
+#ifndef SealdSessionStore_h
+#define SealdSessionStore_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** \cond */
+/**
+ * SealdSessionStore persists serialized encryption sessions on disk, next to the SDK database, so that they can be used without network.
+ * Each session is stored in its own file, named after a hash of its ID, with its expiration date, encrypted with AES-256-CBC and authenticated with HMAC-SHA256,
+ * with keys derived from the database encryption key. When it holds more than `maxEntries` sessions, the least recently used unpinned ones are evicted.
+ * It also keeps an encrypted manifest of the recently used and pinned session IDs, used to warm up the memory cache on startup,
+ * and of the groups via which sessions were retrieved, with the last sigchain hash seen for each of them.
+ * Used by SealdSdk when SealdSdkOptions.sessionStoreMaxEntries is set.
+ */
+@interface SealdSessionStore : NSObject
+@property (atomic, strong, readonly) NSString* directory;
+@property (atomic, assign, readonly) NSInteger maxEntries;
+/** The number of sessions currently stored. */
+@property (atomic, assign, readonly) NSInteger count;
+/** Sessions evicted to stay within `maxEntries`, since the last resetCounters. */
+@property (atomic, assign, readonly) NSInteger evictions;
+/**
+ * Called with the errors that have no caller to return them to: failures to save a session or the manifest, which are written in the background,
+ * and an invalid manifest ignored while initializing. The store keeps working without the failed write or the ignored manifest.
+ */
+@property (atomic, copy, readonly, nullable) void (^onError)(NSError* error);
+- (nullable instancetype) initWithDirectory:(NSString*)directory
+                              encryptionKey:(NSData*)encryptionKey
+                                 maxEntries:(NSInteger)maxEntries
+                                    onError:(void (^_Nullable)(NSError* error))onError
+                                      error:(NSError*_Nullable*)error;
+/** Returns the serialized session, or `nil` if it is not stored, or has expired or cannot be authenticated, in which case it is removed. */
+- (nullable NSString*) loadSessionWithId:(NSString*)sessionId;
+/**
+ * Stores the serialized session, evicting the least recently used sessions if needed. Errors are passed to `onError`.
+ * If the session was retrieved via a group, `groupId` is kept in the manifest, so that the sessions of a group can be invalidated together.
+ * The session is not returned by loadSessionWithId: after `expiresAt`. `nil` for it to never expire.
+ */
+- (void) saveSession:(NSString*)serializedSession
+              withId:(NSString*)sessionId
+             groupId:(NSString*_Nullable)groupId
+           expiresAt:(NSDate*_Nullable)expiresAt;
+/** Changes the expiration date of a stored session, if it is stored. `nil` for it to never expire. */
+- (void) setExpiresAt:(NSDate*_Nullable)expiresAt
+     forSessionWithId:(NSString*)sessionId;
+- (void) removeSessionWithId:(NSString*)sessionId;
+- (void) removeAllSessions;
+/** Moves the session to the front of the recent-sessions manifest. The manifest is written to disk shortly after. */
+- (void) recordUseOfSessionWithId:(NSString*)sessionId;
+/** Returns up to `limit` session IDs from the recent-sessions manifest, most recently used first. */
+- (NSArray<NSString*>*) recentSessionIdsWithLimit:(NSInteger)limit;
+/** Pinned sessions are never evicted. Pins are kept in the manifest. */
+- (void) setPinned:(BOOL)pinned
+  forSessionWithId:(NSString*)sessionId;
+- (NSArray<NSString*>*) pinnedSessionIds;
+/** The IDs of the stored sessions retrieved via `groupId`. */
+- (NSArray<NSString*>*) sessionIdsOfGroup:(NSString*)groupId;
+/** The IDs of the groups via which stored sessions were retrieved. */
+- (NSArray<NSString*>*) groupIds;
+/** The last sigchain hash seen for each group via which stored sessions were retrieved, kept in the manifest so that group changes are detected across launches. */
+- (NSDictionary<NSString*, NSString*>*) groupSigchainHashes;
+/** Sets the last sigchain hash seen for a group. The manifest is written to disk shortly after. */
+- (void) setSigchainHash:(NSString*)sigchainHash
+              forGroupId:(NSString*)groupId;
+/** Writes the manifest to disk now if it changed. Errors are passed to `onError`. */
+- (void) flushManifest;
+/** The total size of the stored sessions on disk, in bytes. */
+- (NSInteger) diskSize;
+- (void) resetCounters;
+@end
+/** \endcond */
+
+NS_ASSUME_NONNULL_END
+
+#endif /* SealdSessionStore_h */
@@ -0,0 +1,504 @@
+//
+//  SealdSessionStore.m
+//  SealdSdk
+//
+//  Created by Seald SAS on 18/10/2026.
+//  Copyright © 2026 Seald SAS. All rights reserved.
+//
+
+#import "SealdSessionStore.h"
+#import "Helpers.h"
+#import <CommonCrypto/CommonCrypto.h>
+
+static const uint8_t storeFormatVersion = 1;
+static const NSTimeInterval manifestFlushDelay = 5;
+
+static NSData* hmacSha256(NSData* key, NSData* data)
+{
+    NSMutableData* mac = [NSMutableData dataWithLength:CC_SHA256_DIGEST_LENGTH];
+    CCHmac(kCCHmacAlgSHA256, key.bytes, key.length, data.bytes, data.length, mac.mutableBytes);
+    return mac;
+}
+
+static NSString* sha256Hex(NSString* string)
+{
+    NSData* data = [string dataUsingEncoding:NSUTF8StringEncoding];
+    uint8_t digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(data.bytes, (CC_LONG)data.length, digest);
+    NSMutableString* hex = [NSMutableString stringWithCapacity:CC_SHA256_DIGEST_LENGTH * 2];
+    for (int i = 0; i < CC_SHA256_DIGEST_LENGTH; i++) {
+        [hex appendFormat:@"%02x", digest[i]];
+    }
+    return hex;
+}
+
+@implementation SealdSessionStore {
+    NSData* encKey;
+    NSData* macKey;
+    NSInteger entriesCount;
+    NSMutableOrderedSet<NSString*>* recentIds;
+    NSMutableSet<NSString*>* pinnedIds;
+    NSMutableSet<NSString*>* pinnedFiles;
+    BOOL manifestDirty;
+    BOOL manifestFlushScheduled;
+    NSInteger evictionsCount;
+    // Session ID -> ID of the group via which it was retrieved.
+    NSMutableDictionary<NSString*, NSString*>* sessionGroups;
+    // Group ID -> last sigchain hash seen.
+    NSMutableDictionary<NSString*, NSString*>* groupHashes;
+}
+
+- (nullable instancetype) initWithDirectory:(NSString*)directory
+                              encryptionKey:(NSData*)encryptionKey
+                                 maxEntries:(NSInteger)maxEntries
+                                    onError:(void (^_Nullable)(NSError* error))onError
+                                      error:(NSError*_Nullable*)error
+{
+    self = [super init];
+    if (self) {
+        _directory = directory;
+        _maxEntries = maxEntries;
+        _onError = onError;
+        encKey = hmacSha256(encryptionKey, [@"SealdSessionStore encryption" dataUsingEncoding:NSUTF8StringEncoding]);
+        macKey = hmacSha256(encryptionKey, [@"SealdSessionStore authentication" dataUsingEncoding:NSUTF8StringEncoding]);
+        NSFileManager* fm = [NSFileManager defaultManager];
+        if (![fm createDirectoryAtPath:directory withIntermediateDirectories:YES attributes:nil error:error]) {
+            return nil;
+        }
+        NSArray<NSString*>* files = [fm contentsOfDirectoryAtPath:directory error:error];
+        if (files == nil) {
+            return nil;
+        }
+        entriesCount = [files count];
+        recentIds = [NSMutableOrderedSet orderedSet];
+        pinnedIds = [NSMutableSet set];
+        pinnedFiles = [NSMutableSet set];
+        sessionGroups = [NSMutableDictionary dictionary];
+        groupHashes = [NSMutableDictionary dictionary];
+        [self _loadManifest];
+    }
+    return self;
+}
+
+- (NSInteger) count
+{
+    @synchronized (self) {
+        return entriesCount;
+    }
+}
+
+- (void) _reportError:(NSError*)error
+{
+    void (^onError)(NSError* error) = self.onError;
+    if (onError) {
+        onError(error);
+    }
+}
+
+- (NSString*) _pathForSessionId:(NSString*)sessionId
+{
+    return [self.directory stringByAppendingPathComponent:sha256Hex(sessionId)];
+}
+
+// The MAC covers the context (the session ID, or the manifest), so that a file cannot be swapped for another one.
+- (NSData*) _macForContext:(NSString*)context
+                   payload:(NSData*)payload
+{
+    NSMutableData* authenticated = [NSMutableData dataWithData:[context dataUsingEncoding:NSUTF8StringEncoding]];
+    [authenticated appendData:payload];
+    return hmacSha256(macKey, authenticated);
+}
+
+// Encrypts and authenticates `clear`, binding it to `context`.
+// version (1) | IV (16) | ciphertext | HMAC (32)
+- (NSData*) _sealData:(NSData*)clear
+              context:(NSString*)context
+                error:(NSError*_Nullable*)error
+{
+    NSMutableData* payload = [NSMutableData dataWithLength:1 + kCCBlockSizeAES128 + clear.length + kCCBlockSizeAES128];
+    uint8_t* bytes = payload.mutableBytes;
+    bytes[0] = storeFormatVersion;
+    arc4random_buf(bytes + 1, kCCBlockSizeAES128);
+    size_t ciphertextLength = 0;
+    CCCryptorStatus status = CCCrypt(kCCEncrypt, kCCAlgorithmAES, kCCOptionPKCS7Padding, encKey.bytes, kCCKeySizeAES256, bytes + 1,
+                                     clear.bytes, clear.length, bytes + 1 + kCCBlockSizeAES128, clear.length + kCCBlockSizeAES128, &ciphertextLength);
+    if (status != kCCSuccess) {
+        _SealdInternal_SetError(@"SESSION_STORE_ENCRYPTION_FAILED", [NSString stringWithFormat:@"CCCrypt failed with status %d", status], error);
+        return nil;
+    }
+    payload.length = 1 + kCCBlockSizeAES128 + ciphertextLength;
+    NSMutableData* sealed = [NSMutableData dataWithData:payload];
+    [sealed appendData:[self _macForContext:context payload:payload]];
+    return sealed;
+}
+
+// Returns the clear data, or `nil` if `sealed` is malformed, or was not sealed with this key for `context`.
+- (NSData*) _openData:(NSData*)sealed
+              context:(NSString*)context
+{
+    if (sealed.length < 1 + kCCBlockSizeAES128 + kCCBlockSizeAES128 + CC_SHA256_DIGEST_LENGTH || ((const uint8_t*)sealed.bytes)[0] != storeFormatVersion) {
+        return nil;
+    }
+    NSData* payload = [sealed subdataWithRange:NSMakeRange(0, sealed.length - CC_SHA256_DIGEST_LENGTH)];
+    NSData* mac = [sealed subdataWithRange:NSMakeRange(sealed.length - CC_SHA256_DIGEST_LENGTH, CC_SHA256_DIGEST_LENGTH)];
+    NSData* expectedMac = [self _macForContext:context payload:payload];
+    if (timingsafe_bcmp(mac.bytes, expectedMac.bytes, CC_SHA256_DIGEST_LENGTH) != 0) {
+        return nil;
+    }
+    const uint8_t* iv = (const uint8_t*)payload.bytes + 1;
+    NSData* ciphertext = [payload subdataWithRange:NSMakeRange(1 + kCCBlockSizeAES128, payload.length - 1 - kCCBlockSizeAES128)];
+    NSMutableData* clear = [NSMutableData dataWithLength:ciphertext.length];
+    size_t clearLength = 0;
+    CCCryptorStatus status = CCCrypt(kCCDecrypt, kCCAlgorithmAES, kCCOptionPKCS7Padding, encKey.bytes, kCCKeySizeAES256, iv,
+                                     ciphertext.bytes, ciphertext.length, clear.mutableBytes, clear.length, &clearLength);
+    if (status != kCCSuccess) {
+        return nil;
+    }
+    clear.length = clearLength;
+    return clear;
+}
+
+// Files hold {"session": serialized session, "expiresAt": seconds since 1970, or null if it never expires}.
+- (NSDictionary*) _loadEntryWithId:(NSString*)sessionId
+                              path:(NSString*)path
+{
+    NSData* file = [NSData dataWithContentsOfFile:path];
+    if (file == nil) {
+        return nil;
+    }
+    NSData* clear = [self _openData:file context:sessionId];
+    NSDictionary* entry = clear != nil ? [NSJSONSerialization JSONObjectWithData:clear options:0 error:nil] : nil;
+    if (![entry isKindOfClass:[NSDictionary class]] || ![entry[@"session"] isKindOfClass:[NSString class]]) {
+        [self removeSessionWithId:sessionId];
+        return nil;
+    }
+    return entry;
+}
+
+- (nullable NSString*) loadSessionWithId:(NSString*)sessionId
+{
+    NSString* path = [self _pathForSessionId:sessionId];
+    NSDictionary* entry = [self _loadEntryWithId:sessionId path:path];
+    if (entry == nil) {
+        return nil;
+    }
+    id expiresAt = entry[@"expiresAt"];
+    if ([expiresAt isKindOfClass:[NSNumber class]] && [expiresAt doubleValue] <= [[NSDate date] timeIntervalSince1970]) {
+        [self removeSessionWithId:sessionId];
+        return nil;
+    }
+    // The modification date is the last use date, used for LRU eviction.
+    [[NSFileManager defaultManager] setAttributes:@{NSFileModificationDate: [NSDate date]} ofItemAtPath:path error:nil];
+    return entry[@"session"];
+}
+
+- (void) saveSession:(NSString*)serializedSession
+              withId:(NSString*)sessionId
+             groupId:(NSString*_Nullable)groupId
+           expiresAt:(NSDate*_Nullable)expiresAt
+{
+    NSDictionary* entry = @{@"session": serializedSession, @"expiresAt": expiresAt != nil ? @([expiresAt timeIntervalSince1970]) : [NSNull null]};
+    NSError* localErr = nil;
+    NSData* file = [self _sealData:[NSJSONSerialization dataWithJSONObject:entry options:0 error:nil] context:sessionId error:&localErr];
+    if (file == nil) {
+        [self _reportError:localErr];
+        return;
+    }
+    NSString* path = [self _pathForSessionId:sessionId];
+    @synchronized (self) {
+        BOOL existed = [[NSFileManager defaultManager] fileExistsAtPath:path];
+        if (![file writeToFile:path options:NSDataWritingAtomic | NSDataWritingFileProtectionCompleteUntilFirstUserAuthentication error:&localErr]) {
+            [self _reportError:localErr];
+            return;
+        }
+        if (!existed) {
+            entriesCount++;
+        }
+        if (groupId != nil && ![sessionGroups[sessionId] isEqualToString:(NSString*)groupId]) {
+            sessionGroups[sessionId] = groupId;
+            manifestDirty = YES;
+        }
+        if (entriesCount > self.maxEntries) {
+            [self _evict];
+        }
+    }
+}
+
+- (void) setExpiresAt:(NSDate*_Nullable)expiresAt
+     forSessionWithId:(NSString*)sessionId
+{
+    NSString* path = [self _pathForSessionId:sessionId];
+    NSDictionary* entry = [self _loadEntryWithId:sessionId path:path];
+    if (entry == nil) {
+        return;
+    }
+    NSDate* modificationDate = [[[NSFileManager defaultManager] attributesOfItemAtPath:path error:nil] fileModificationDate];
+    @synchronized (self) {
+        [self saveSession:entry[@"session"] withId:sessionId groupId:sessionGroups[sessionId] expiresAt:expiresAt];
+    }
+    // Changing the expiration date is not a use: keep the place of the session in the LRU order.
+    if (modificationDate != nil) {
+        [[NSFileManager defaultManager] setAttributes:@{NSFileModificationDate: modificationDate} ofItemAtPath:path error:nil];
+    }
+}
+
+// Must be called while holding the lock on `self`.
+// Evicts down to 90% of `maxEntries`, so that eviction does not run on every save once the store is full.
+- (void) _evict
+{
+    NSFileManager* fm = [NSFileManager defaultManager];
+    NSArray<NSURL*>* files = [fm contentsOfDirectoryAtURL:[NSURL fileURLWithPath:self.directory]
+                               includingPropertiesForKeys:@[NSURLContentModificationDateKey]
+                                                  options:0
+                                                    error:nil];
+    NSArray<NSURL*>* sorted = [files sortedArrayUsingComparator:^NSComparisonResult (NSURL* a, NSURL* b) {
+        NSDate* dateA = nil;
+        NSDate* dateB = nil;
+        [a getResourceValue:&dateA forKey:NSURLContentModificationDateKey error:nil];
+        [b getResourceValue:&dateB forKey:NSURLContentModificationDateKey error:nil];
+        return [dateA compare:dateB];
+    }];
+    NSInteger target = self.maxEntries * 9 / 10;
+    NSInteger remaining = [sorted count];
+    for (NSURL* url in sorted) {
+        if (remaining <= target) {
+            break;
+        }
+        if ([pinnedFiles containsObject:[url lastPathComponent]]) {
+            continue;
+        }
+        if ([fm removeItemAtURL:url error:nil]) {
+            remaining--;
+            evictionsCount++;
+        }
+    }
+    entriesCount = remaining;
+    // File names are hashes, so the group index is pruned by checking which of its sessions are still there.
+    for (NSString* sessionId in [sessionGroups allKeys]) {
+        if (![fm fileExistsAtPath:[self _pathForSessionId:sessionId]]) {
+            [sessionGroups removeObjectForKey:sessionId];
+            manifestDirty = YES;
+        }
+    }
+}
+
+- (NSInteger) evictions
+{
+    @synchronized (self) {
+        return evictionsCount;
+    }
+}
+
+- (void) resetCounters
+{
+    @synchronized (self) {
+        evictionsCount = 0;
+    }
+}
+
+- (NSInteger) diskSize
+{
+    NSArray<NSURL*>* files = [[NSFileManager defaultManager] contentsOfDirectoryAtURL:[NSURL fileURLWithPath:self.directory]
+                                                           includingPropertiesForKeys:@[NSURLFileSizeKey]
+                                                                              options:0
+                                                                                error:nil];
+    NSInteger res = 0;
+    for (NSURL* url in files) {
+        NSNumber* size = nil;
+        [url getResourceValue:&size forKey:NSURLFileSizeKey error:nil];
+        res += [size integerValue];
+    }
+    return res;
+}
+
+- (void) removeSessionWithId:(NSString*)sessionId
+{
+    @synchronized (self) {
+        if ([[NSFileManager defaultManager] removeItemAtPath:[self _pathForSessionId:sessionId] error:nil]) {
+            entriesCount--;
+        }
+        if ([recentIds containsObject:sessionId]) {
+            [recentIds removeObject:sessionId];
+            manifestDirty = YES;
+        }
+        if (sessionGroups[sessionId] != nil) {
+            [sessionGroups removeObjectForKey:sessionId];
+            manifestDirty = YES;
+        }
+    }
+}
+
+- (void) removeAllSessions
+{
+    NSFileManager* fm = [NSFileManager defaultManager];
+    @synchronized (self) {
+        for (NSString* file in [fm contentsOfDirectoryAtPath:self.directory error:nil]) {
+            [fm removeItemAtPath:[self.directory stringByAppendingPathComponent:file] error:nil];
+        }
+        entriesCount = 0;
+        [recentIds removeAllObjects];
+        [sessionGroups removeAllObjects];
+        [groupHashes removeAllObjects];
+        manifestDirty = YES;
+    }
+}
+
+- (NSString*) _manifestPath
+{
+    // Next to the directory rather than in it, so that it is not counted nor evicted as a session.
+    return [self.directory stringByAppendingString:@".manifest"];
+}
+
+- (void) _loadManifest
+{
+    NSData* file = [NSData dataWithContentsOfFile:[self _manifestPath]];
+    if (file == nil) {
+        return;
+    }
+    NSData* clear = [self _openData:file context:@"manifest"];
+    NSDictionary* manifest = clear != nil ? [NSJSONSerialization JSONObjectWithData:clear options:0 error:nil] : nil;
+    if (![manifest isKindOfClass:[NSDictionary class]]) {
+        NSError* localErr = nil;
+        _SealdInternal_SetError(@"INVALID_SESSION_STORE_MANIFEST", @"The session store manifest cannot be authenticated or parsed, and was ignored", &localErr);
+        [self _reportError:localErr];
+        return;
+    }
+    for (NSString* sessionId in manifest[@"recent"]) {
+        [recentIds addObject:sessionId];
+    }
+    for (NSString* sessionId in manifest[@"pinned"]) {
+        [pinnedIds addObject:sessionId];
+        [pinnedFiles addObject:sha256Hex(sessionId)];
+    }
+    NSDictionary<NSString*, NSString*>* groups = manifest[@"groups"];
+    if ([groups isKindOfClass:[NSDictionary class]]) {
+        [sessionGroups addEntriesFromDictionary:groups];
+    }
+    NSDictionary<NSString*, NSString*>* hashes = manifest[@"groupHashes"];
+    if ([hashes isKindOfClass:[NSDictionary class]]) {
+        [groupHashes addEntriesFromDictionary:hashes];
+    }
+}
+
+- (void) recordUseOfSessionWithId:(NSString*)sessionId
+{
+    @synchronized (self) {
+        [recentIds removeObject:sessionId];
+        [recentIds addObject:sessionId];
+        while ((NSInteger)[recentIds count] > self.maxEntries) {
+            [recentIds removeObjectAtIndex:0];
+        }
+        manifestDirty = YES;
+        if (manifestFlushScheduled) {
+            return;
+        }
+        manifestFlushScheduled = YES;
+    }
+    // Uses are batched, so that a burst of retrievals writes the manifest once.
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(manifestFlushDelay * NSEC_PER_SEC)), dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        [self flushManifest];
+    });
+}
+
+- (NSArray<NSString*>*) recentSessionIdsWithLimit:(NSInteger)limit
+{
+    @synchronized (self) {
+        NSMutableArray<NSString*>* res = [NSMutableArray arrayWithCapacity:MIN(limit, (NSInteger)[recentIds count])];
+        for (NSString* sessionId in [recentIds reverseObjectEnumerator]) {
+            if ((NSInteger)[res count] >= limit) {
+                break;
+            }
+            [res addObject:sessionId];
+        }
+        return res;
+    }
+}
+
+- (void) setPinned:(BOOL)pinned
+  forSessionWithId:(NSString*)sessionId
+{
+    @synchronized (self) {
+        if (pinned) {
+            [pinnedIds addObject:sessionId];
+            [pinnedFiles addObject:sha256Hex(sessionId)];
+        } else {
+            [pinnedIds removeObject:sessionId];
+            [pinnedFiles removeObject:sha256Hex(sessionId)];
+        }
+        manifestDirty = YES;
+    }
+    [self flushManifest];
+}
+
+- (NSArray<NSString*>*) pinnedSessionIds
+{
+    @synchronized (self) {
+        return [pinnedIds allObjects];
+    }
+}
+
+- (NSArray<NSString*>*) sessionIdsOfGroup:(NSString*)groupId
+{
+    @synchronized (self) {
+        return [sessionGroups allKeysForObject:groupId];
+    }
+}
+
+- (NSArray<NSString*>*) groupIds
+{
+    @synchronized (self) {
+        return [[NSSet setWithArray:[sessionGroups allValues]] allObjects];
+    }
+}
+
+- (NSDictionary<NSString*, NSString*>*) groupSigchainHashes
+{
+    @synchronized (self) {
+        return [groupHashes copy];
+    }
+}
+
+- (void) setSigchainHash:(NSString*)sigchainHash
+              forGroupId:(NSString*)groupId
+{
+    @synchronized (self) {
+        if ([groupHashes[groupId] isEqualToString:sigchainHash]) {
+            return;
+        }
+        groupHashes[groupId] = sigchainHash;
+        manifestDirty = YES;
+        if (manifestFlushScheduled) {
+            return;
+        }
+        manifestFlushScheduled = YES;
+    }
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(manifestFlushDelay * NSEC_PER_SEC)), dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        [self flushManifest];
+    });
+}
+
+- (void) flushManifest
+{
+    NSData* json = nil;
+    @synchronized (self) {
+        manifestFlushScheduled = NO;
+        if (!manifestDirty) {
+            return;
+        }
+        manifestDirty = NO;
+        // Hashes of groups without stored sessions anymore are not needed.
+        NSSet<NSString*>* storedGroupIds = [NSSet setWithArray:[sessionGroups allValues]];
+        for (NSString* groupId in [groupHashes allKeys]) {
+            if (![storedGroupIds containsObject:groupId]) {
+                [groupHashes removeObjectForKey:groupId];
+            }
+        }
+        json = [NSJSONSerialization dataWithJSONObject:@{@"recent": [recentIds array], @"pinned": [pinnedIds allObjects], @"groups": sessionGroups, @"groupHashes": groupHashes} options:0 error:nil];
+    }
+    NSError* localErr = nil;
+    NSData* file = [self _sealData:json context:@"manifest" error:&localErr];
+    if (file == nil || ![file writeToFile:[self _manifestPath] options:NSDataWritingAtomic | NSDataWritingFileProtectionCompleteUntilFirstUserAuthentication error:&localErr]) {
+        [self _reportError:localErr];
+    }
+}
+@end